@@ -249,6 +249,11 @@ namespace ig
 		}
 		pipe.RasterizerState.FillMode = desc.rasterizerState.enableWireframe ? D3D12_FILL_MODE_WIREFRAME : D3D12_FILL_MODE_SOLID;
 
+		// D3D12 has no rasterizer discard state. Rasterization is disabled when there is no pixel shader
+		// and depth/stencil testing is disabled, so the pixel shader and depth/stencil state are dropped.
+		const bool discardRasterization = desc.rasterizerState.enableRasterizerDiscard;
+		if (discardRasterization) pipe.PS = {};
+
 		// Depth
 		pipe.DepthStencilState = {};
 		pipe.DepthStencilState.DepthEnable = desc.depthState.enableDepth;
@@ -265,6 +270,11 @@ namespace ig
 		pipe.DepthStencilState.BackFace.StencilDepthFailOp = (D3D12_STENCIL_OP)desc.depthState.backFaceStencilDepthFailOp;
 		pipe.DepthStencilState.BackFace.StencilPassOp = (D3D12_STENCIL_OP)desc.depthState.backFaceStencilPassOp;
 		pipe.DepthStencilState.BackFace.StencilFunc = (D3D12_COMPARISON_FUNC)desc.depthState.backFaceStencilFunc;
+		if (discardRasterization)
+		{
+			pipe.DepthStencilState.DepthEnable = false;
+			pipe.DepthStencilState.StencilEnable = false;
+		}
 
 		// Vertex layout
 		std::vector<D3D12_INPUT_ELEMENT_DESC> inputLayout = ToD3D12InputElements(desc.vertexLayout);
@@ -753,6 +763,51 @@ namespace ig
 		SetRenderTargets(renderTextures, numRenderTextures, depthBuffer, optimizedClear);
 	}
 
+	void CommandList::BeginRenderPass(const Texture* renderTexture, AttachmentOps colorOps,
+		const Texture* depthBuffer, AttachmentOps depthOps)
+	{
+		if (renderTexture)
+		{
+			const Texture* renderTextures[] = { renderTexture };
+			BeginRenderPassMultiTarget(renderTextures, &colorOps, 1, depthBuffer, depthOps);
+		}
+		else
+		{
+			BeginRenderPassMultiTarget(nullptr, nullptr, 0, depthBuffer, depthOps);
+		}
+	}
+	void CommandList::BeginRenderPassMultiTarget(const Texture* const* renderTextures, const AttachmentOps* colorOps, uint32_t numRenderTextures,
+		const Texture* depthBuffer, AttachmentOps depthOps)
+	{
+		if (numRenderTextures > 0) assert(renderTextures && colorOps);
+
+		SetRenderTargets(renderTextures, numRenderTextures, depthBuffer, false);
+
+		// Store ops are ignored, since D3D12 render targets are bound without render passes here.
+		for (uint32_t i = 0; i < numRenderTextures; i++)
+		{
+			if (colorOps[i].load == LoadOp::Clear)
+			{
+				ClearColor(*renderTextures[i], colorOps[i].clearValue.color);
+			}
+			else if (colorOps[i].load == LoadOp::DontCare)
+			{
+				impl.graphicsCommandList->DiscardResource(renderTextures[i]->GetD3D12Resource(), nullptr);
+			}
+		}
+		if (depthBuffer)
+		{
+			if (depthOps.load == LoadOp::Clear)
+			{
+				ClearDepth(*depthBuffer, depthOps.clearValue.depth, depthOps.clearValue.stencil, true, true);
+			}
+			else if (depthOps.load == LoadOp::DontCare)
+			{
+				impl.graphicsCommandList->DiscardResource(depthBuffer->GetD3D12Resource(), nullptr);
+			}
+		}
+	}
+
 	void CommandList::EndRenderPass()
 	{
 		SetRenderTarget(nullptr);
@@ -1619,6 +1674,25 @@ namespace ig
 						device->CreateUnorderedAccessView(currentResource.Get(), nullptr, &uavDesc, heap.GetD3D12CPUHandle(currentUAV));
 					}
 				}
+				else if (desc.type == BufferType::VertexBuffer)
+				{
+					if (desc.usage == BufferUsage::UnorderedAccess)
+					{
+						currentUAV = heap.AllocatePersistent(DescriptorType::Resource);
+						D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = GenerateD3D12Desc_UAV_Raw(desc.size);
+						device->CreateUnorderedAccessView(currentResource.Get(), nullptr, &uavDesc, heap.GetD3D12CPUHandle(currentUAV));
+					}
+				}
+				else if (desc.type == BufferType::TypedBuffer)
+				{
+					if (GetFormatInfoDXGI(desc.format).dxgiFormat == DXGI_FORMAT_UNKNOWN)
+					{
+						return DetailedResult::Fail("Format not supported in D3D12.");
+					}
+					currentCBV_SRV = heap.AllocatePersistent(DescriptorType::Resource);
+					D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = GenerateD3D12Desc_SRV_Typed(desc.format, desc.numElements);
+					device->CreateShaderResourceView(currentResource.Get(), &srvDesc, heap.GetD3D12CPUHandle(currentCBV_SRV));
+				}
 			}
 		}
 
@@ -1641,6 +1715,11 @@ namespace ig
 		}
 	}
 
+	uint64_t Buffer::GetGPUAddress() const
+	{
+		return GetD3D12Resource()->GetGPUVirtualAddress();
+	}
+
 	D3D12_CONSTANT_BUFFER_VIEW_DESC Buffer::GenerateD3D12Desc_CBV(ID3D12Resource* bufferLocation,
 		const BufferPlacementAlignments& bufferPlacementAlignments, uint64_t sizeOfData)
 	{
@@ -1690,6 +1769,24 @@ namespace ig
 		return out;
 	}
 
+	D3D12_SHADER_RESOURCE_VIEW_DESC Buffer::GenerateD3D12Desc_SRV_Typed(Format format, uint32_t numElements, uint64_t firstElement)
+	{
+		D3D12_SHADER_RESOURCE_VIEW_DESC out =
+		{
+			.Format = GetFormatInfoDXGI(format).dxgiFormat,
+			.ViewDimension = D3D12_SRV_DIMENSION_BUFFER,
+			.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+			.Buffer =
+			{
+				.FirstElement = firstElement,
+				.NumElements = numElements,
+				.StructureByteStride = 0,
+				.Flags = D3D12_BUFFER_SRV_FLAG_NONE,
+			},
+		};
+		return out;
+	}
+
 	D3D12_UNORDERED_ACCESS_VIEW_DESC Buffer::GenerateD3D12Desc_UAV_Structured(uint32_t numElements, uint32_t stride, uint64_t firstElement)
 	{
 		D3D12_UNORDERED_ACCESS_VIEW_DESC out =
@@ -2369,6 +2466,7 @@ namespace ig
 			graphicsSpecs.rendererName = adapterName;
 			graphicsSpecs.vendorName = GetGpuVendorNameFromID(adapterDesc.VendorId);
 			graphicsSpecs.maxTextureDimension = 16384;
+			graphicsSpecs.maxTypedBufferElements = 1u << D3D12_REQ_BUFFER_RESOURCE_TEXEL_COUNT_2_TO_EXP;
 			graphicsSpecs.bufferPlacementAlignments =
 			{
 				.vertexOrIndexBuffer = 4,
@@ -2385,6 +2483,19 @@ namespace ig
 				.vsyncHalf = true,
 			};
 
+			// Optional shader features
+			graphicsSpecs.supportedShaderFeatures = SupportedShaderFeatures();
+			D3D12_FEATURE_DATA_D3D12_OPTIONS4 opt4 = {};
+			if (SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS4, &opt4, sizeof(opt4))))
+			{
+				graphicsSpecs.supportedShaderFeatures.float16 = opt4.Native16BitShaderOpsSupported;
+			}
+			D3D12_FEATURE_DATA_D3D12_OPTIONS1 opt1 = {};
+			if (SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS1, &opt1, sizeof(opt1))))
+			{
+				graphicsSpecs.supportedShaderFeatures.waveOps = opt1.WaveOps;
+			}
+
 			graphics.adapter = adapter;
 			graphics.device = device;
 			return DetailedResult::Success();
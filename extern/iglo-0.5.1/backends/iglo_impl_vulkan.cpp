@@ -201,6 +201,7 @@ namespace ig
 			Check(feats2.features.independentBlend, "independentBlend");
 			Check(feats2.features.samplerAnisotropy, "samplerAnisotropy");
 			Check(feats12.timelineSemaphore, "timelineSemaphore");
+			Check(feats12.bufferDeviceAddress, "bufferDeviceAddress");
 			Check(feats13.dynamicRendering, "dynamicRendering");
 			Check(feats13.synchronization2, "synchronization2");
 			Check(maintenance5Feats.maintenance5, "maintenance5");
@@ -533,6 +534,31 @@ namespace ig
 		}
 	}
 
+	VkAttachmentLoadOp ToVulkanLoadOp(LoadOp loadOp)
+	{
+		switch (loadOp)
+		{
+		case LoadOp::Load: return VK_ATTACHMENT_LOAD_OP_LOAD;
+		case LoadOp::Clear: return VK_ATTACHMENT_LOAD_OP_CLEAR;
+		case LoadOp::DontCare: return VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+
+		default:
+			Fatal("Invalid load op.");
+		}
+	}
+
+	VkAttachmentStoreOp ToVulkanStoreOp(StoreOp storeOp)
+	{
+		switch (storeOp)
+		{
+		case StoreOp::Store: return VK_ATTACHMENT_STORE_OP_STORE;
+		case StoreOp::DontCare: return VK_ATTACHMENT_STORE_OP_DONT_CARE;
+
+		default:
+			Fatal("Invalid store op.");
+		}
+	}
+
 	uint64_t GetRequiredUploadBufferSize(const Image& image, const BufferPlacementAlignments& alignments)
 	{
 		uint64_t size = 0;
@@ -592,7 +618,7 @@ namespace ig
 		// Check max descriptor count
 		for (uint32_t i = 0; i < NUM_VK_DESCRIPTOR_TYPES; i++)
 		{
-			uint32_t totalAlloc = (i == (uint32_t)DescriptorType::Sampler) ? limits.samplers : totalResDescriptors;
+			uint32_t totalAlloc = (vkDescriptorTypeTable[i] == VK_DESCRIPTOR_TYPE_SAMPLER) ? limits.samplers : totalResDescriptors;
 			if (totalAlloc > propMax[i])
 			{
 				/*
@@ -642,7 +668,7 @@ namespace ig
 				VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
 
 			VkMutableDescriptorTypeListEXT typeList = {};
-			typeList.descriptorTypeCount = 4; // The first 4 elements in the table are resource descriptors which we want mutable.
+			typeList.descriptorTypeCount = NUM_VK_DESCRIPTOR_TYPES - 1; // All elements except the last (sampler) are resource descriptors which we want mutable.
 			typeList.pDescriptorTypes = vkDescriptorTypeTable.data();
 
 			VkMutableDescriptorTypeCreateInfoEXT mutableInfo = {};
@@ -742,6 +768,7 @@ namespace ig
 			indexingProps.maxPerStageDescriptorUpdateAfterBindStorageBuffers,
 			indexingProps.maxPerStageDescriptorUpdateAfterBindSampledImages,
 			indexingProps.maxPerStageDescriptorUpdateAfterBindStorageImages,
+			indexingProps.maxPerStageDescriptorUpdateAfterBindSampledImages, // Uniform texel buffers count as sampled images
 			indexingProps.maxPerStageDescriptorUpdateAfterBindSamplers
 		};
 		return out;
@@ -798,6 +825,25 @@ namespace ig
 		vkUpdateDescriptorSets(context.GetVulkanDevice(), 1, &write, 0, nullptr);
 	}
 
+	void DescriptorHeap::WriteTexelBufferDescriptor(Descriptor descriptor, VulkanDescriptorType type, VkBufferView view)
+	{
+		assert(descriptor);
+		assert(type == VulkanDescriptorType::TypedBuffer_SRV);
+
+		VkWriteDescriptorSet write =
+		{
+			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+			.dstSet = impl.descriptorSet,
+			.dstBinding = VK_BINDING_NON_SAMPLER,
+			.dstArrayElement = descriptor.heapIndex,
+			.descriptorCount = 1,
+			.descriptorType = (VkDescriptorType)type,
+			.pTexelBufferView = &view,
+		};
+
+		vkUpdateDescriptorSets(context.GetVulkanDevice(), 1, &write, 0, nullptr);
+	}
+
 	void DescriptorHeap::WriteSamplerDescriptor(Descriptor descriptor, VkSampler sampler)
 	{
 		assert(descriptor);
@@ -926,7 +972,7 @@ namespace ig
 		rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
 		rasterizer.pNext = &lineState;
 		rasterizer.depthClampEnable = !desc.rasterizerState.enableDepthClip;
-		rasterizer.rasterizerDiscardEnable = VK_FALSE;
+		rasterizer.rasterizerDiscardEnable = desc.rasterizerState.enableRasterizerDiscard ? VK_TRUE : VK_FALSE;
 		rasterizer.polygonMode = desc.rasterizerState.enableWireframe ? VK_POLYGON_MODE_LINE : VK_POLYGON_MODE_FILL;
 		rasterizer.lineWidth = 1.0f;
 		rasterizer.cullMode = vkCullMode;
@@ -1652,6 +1698,38 @@ namespace ig
 		if (numRenderTextures > 0) assert(renderTextures);
 		assert(numRenderTextures <= MAX_SIMULTANEOUS_RENDER_TARGETS && "too many render textures provided");
 
+		const LoadOp loadOp = optimizedClear ? LoadOp::Clear : LoadOp::Load;
+		std::array<AttachmentOps, MAX_SIMULTANEOUS_RENDER_TARGETS> colorOps = {};
+		for (uint32_t i = 0; i < numRenderTextures; i++)
+		{
+			colorOps[i] = { .load = loadOp, .clearValue = renderTextures[i]->GetOptimizedClearValue() };
+		}
+		AttachmentOps depthOps = { .load = loadOp };
+		if (depthBuffer) depthOps.clearValue = depthBuffer->GetOptimizedClearValue();
+
+		BeginRenderPassMultiTarget(renderTextures, colorOps.data(), numRenderTextures, depthBuffer, depthOps);
+	}
+
+	void CommandList::BeginRenderPass(const Texture* renderTexture, AttachmentOps colorOps,
+		const Texture* depthBuffer, AttachmentOps depthOps)
+	{
+		if (renderTexture)
+		{
+			const Texture* renderTextures[] = { renderTexture };
+			BeginRenderPassMultiTarget(renderTextures, &colorOps, 1, depthBuffer, depthOps);
+		}
+		else
+		{
+			BeginRenderPassMultiTarget(nullptr, nullptr, 0, depthBuffer, depthOps);
+		}
+	}
+
+	void CommandList::BeginRenderPassMultiTarget(const Texture* const* renderTextures, const AttachmentOps* colorOps, uint32_t numRenderTextures,
+		const Texture* depthBuffer, AttachmentOps depthOps)
+	{
+		if (numRenderTextures > 0) assert(renderTextures && colorOps);
+		assert(numRenderTextures <= MAX_SIMULTANEOUS_RENDER_TARGETS && "too many render textures provided");
+
 		if (impl.activeRenderPass) Fatal("Can't begin new render pass while a previous render pass is active.");
 		if (impl.nestedPauseCounter > 0) Fatal("Can't begin new render pass while inside a pause/resume block.");
 		if (numRenderTextures == 0 && !depthBuffer) Fatal("Must specify at least one render target when beginning render pass.");
@@ -1663,12 +1741,12 @@ namespace ig
 			attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
 			attachment.imageView = renderTextures[i]->GetVulkanImageView_UAV_RTV_DSV();
 			attachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-			attachment.loadOp = optimizedClear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD;
-			attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+			attachment.loadOp = ToVulkanLoadOp(colorOps[i].load);
+			attachment.storeOp = ToVulkanStoreOp(colorOps[i].store);
 
-			if (optimizedClear)
+			if (colorOps[i].load == LoadOp::Clear)
 			{
-				Color color = renderTextures[i]->GetOptimizedClearValue().color;
+				Color color = colorOps[i].clearValue.color;
 				attachment.clearValue.color = { color.red, color.green, color.blue, color.alpha };
 			}
 		}
@@ -1685,8 +1763,8 @@ namespace ig
 				.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
 				.imageView = depthBuffer->GetVulkanImageView_UAV_RTV_DSV(),
 				.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-				.loadOp = optimizedClear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-				.storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+				.loadOp = ToVulkanLoadOp(depthOps.load),
+				.storeOp = ToVulkanStoreOp(depthOps.store),
 			};
 			if (hasStencil)
 			{
@@ -1695,16 +1773,15 @@ namespace ig
 					 .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
 					 .imageView = depthBuffer->GetVulkanImageView_UAV_RTV_DSV(),
 					 .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-					 .loadOp = optimizedClear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-					 .storeOp = VK_ATTACHMENT_STORE_OP_STORE
+					 .loadOp = ToVulkanLoadOp(depthOps.load),
+					 .storeOp = ToVulkanStoreOp(depthOps.store)
 				};
 			}
 
-			if (optimizedClear)
+			if (depthOps.load == LoadOp::Clear)
 			{
-				ClearValue clearValue = depthBuffer->GetOptimizedClearValue();
-				impl.renderInfo.depthAttachment.clearValue.depthStencil.depth = clearValue.depth;
-				if (hasStencil) impl.renderInfo.stencilAttachment.clearValue.depthStencil.stencil = clearValue.stencil;
+				impl.renderInfo.depthAttachment.clearValue.depthStencil.depth = depthOps.clearValue.depth;
+				if (hasStencil) impl.renderInfo.stencilAttachment.clearValue.depthStencil.stencil = depthOps.clearValue.stencil;
 			}
 
 		}
@@ -1725,14 +1802,6 @@ namespace ig
 
 		vkCmdBeginRendering(impl.currentCommandBuffer, &impl.renderInfo.renderingInfo);
 
-		// It's important we don't clear these render targets again when pausing and resuming render passes later.
-		for (uint32_t i = 0; i < numRenderTextures; i++)
-		{
-			impl.renderInfo.colorAttachments[i].loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-		}
-		if (depthBuffer) impl.renderInfo.depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-		if (hasStencil) impl.renderInfo.stencilAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-
 		// Remember which render targets are active
 		impl.numCurrentRenderTextures = numRenderTextures;
 		for (uint32_t i = 0; i < numRenderTextures; i++)
@@ -2211,7 +2280,20 @@ namespace ig
 
 		if (impl.nestedPauseCounter == 0 && impl.activeRenderPass)
 		{
-			vkCmdBeginRendering(impl.currentCommandBuffer, &impl.renderInfo.renderingInfo);
+			// The load ops only apply when the render pass begins.
+			// It's important we don't clear or discard these render targets again when resuming.
+			VulkanRenderInfo resumeInfo = impl.renderInfo;
+			for (uint32_t i = 0; i < resumeInfo.renderingInfo.colorAttachmentCount; i++)
+			{
+				resumeInfo.colorAttachments[i].loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+			}
+			resumeInfo.depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+			resumeInfo.stencilAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+			resumeInfo.renderingInfo.pColorAttachments = resumeInfo.colorAttachments.data();
+			if (impl.renderInfo.renderingInfo.pDepthAttachment) resumeInfo.renderingInfo.pDepthAttachment = &resumeInfo.depthAttachment;
+			if (impl.renderInfo.renderingInfo.pStencilAttachment) resumeInfo.renderingInfo.pStencilAttachment = &resumeInfo.stencilAttachment;
+
+			vkCmdBeginRendering(impl.currentCommandBuffer, &resumeInfo.renderingInfo);
 		}
 	}
 
@@ -2685,6 +2767,11 @@ namespace ig
 					vkUnmapMemory(device, frame.memory);
 					frame.mapped = nullptr;
 				}
+				if (frame.view)
+				{
+					vkDestroyBufferView(device, frame.view, nullptr);
+					frame.view = VK_NULL_HANDLE;
+				}
 				if (frame.buffer)
 				{
 					vkDestroyBuffer(device, frame.buffer, nullptr);
@@ -2699,6 +2786,11 @@ namespace ig
 			implPerFrame = nullptr;
 		}
 
+		if (impl.view)
+		{
+			vkDestroyBufferView(device, impl.view, nullptr);
+			impl.view = VK_NULL_HANDLE;
+		}
 		if (impl.buffer)
 		{
 			vkDestroyBuffer(device, impl.buffer, nullptr);
@@ -2741,6 +2833,7 @@ namespace ig
 		case BufferType::StructuredBuffer: usageFlags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT; break;
 		case BufferType::RawBuffer: usageFlags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT; break;
 		case BufferType::ShaderConstant: usageFlags |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT; break;
+		case BufferType::TypedBuffer: usageFlags |= VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT; break;
 
 		default:
 			Fatal("Invalid buffer type.");
@@ -2754,6 +2847,7 @@ namespace ig
 			break;
 
 		case BufferUsage::Dynamic:
+			usageFlags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT; // Can be used as a staging buffer with CopyBuffer()
 			break;
 
 		case BufferUsage::Readable:
@@ -2763,12 +2857,16 @@ namespace ig
 		case BufferUsage::UnorderedAccess:
 			usageFlags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 			usageFlags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+			if (desc.type == BufferType::VertexBuffer) usageFlags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			break;
 
 		default:
 			Fatal("Invalid buffer usage.");
 		}
 
+		// All buffers can be accessed through their device address.
+		usageFlags |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
 		VkMemoryPropertyFlags memoryProperties = 0;
 		if (desc.usage == BufferUsage::Dynamic ||
 			desc.usage == BufferUsage::Readable)
@@ -2807,8 +2905,13 @@ namespace ig
 				return DetailedResult::Fail("FindVulkanMemoryType failed.");
 			}
 
+			VkMemoryAllocateFlagsInfo allocFlagsInfo = {};
+			allocFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+			allocFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
 			VkMemoryAllocateInfo allocInfo = {};
 			allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+			allocInfo.pNext = &allocFlagsInfo;
 			allocInfo.allocationSize = memRequirements.size;
 			allocInfo.memoryTypeIndex = memType.value();
 
@@ -2841,6 +2944,7 @@ namespace ig
 			for (uint32_t i = 0; i < numDescriptors; i++)
 			{
 				auto& currentBuffer = implPerFrame ? implPerFrame[i].buffer : impl.buffer;
+				auto& currentView = implPerFrame ? implPerFrame[i].view : impl.view;
 				auto& currentDescriptor = implPerFrame ? implPerFrame[i].cbv_srv_uav : impl.cbv_srv_uav;
 
 				if (desc.type == BufferType::ShaderConstant)
@@ -2853,6 +2957,35 @@ namespace ig
 					currentDescriptor = heap.AllocatePersistent(DescriptorType::Resource);
 					heap.WriteBufferDescriptor(currentDescriptor, VulkanDescriptorType::RawOrStructuredBuffer_SRV_UAV, currentBuffer, 0, desc.size);
 				}
+				else if (desc.type == BufferType::VertexBuffer && desc.usage == BufferUsage::UnorderedAccess)
+				{
+					currentDescriptor = heap.AllocatePersistent(DescriptorType::Resource);
+					heap.WriteBufferDescriptor(currentDescriptor, VulkanDescriptorType::RawOrStructuredBuffer_SRV_UAV, currentBuffer, 0, desc.size);
+				}
+				else if (desc.type == BufferType::TypedBuffer)
+				{
+					VkFormat vulkanFormat = ToVulkanFormat(desc.format);
+					if (vulkanFormat == VK_FORMAT_UNDEFINED)
+					{
+						return DetailedResult::Fail("Format not supported in Vulkan.");
+					}
+					VkBufferViewCreateInfo viewInfo =
+					{
+						.sType = VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO,
+						.buffer = currentBuffer,
+						.format = vulkanFormat,
+						.offset = 0,
+						.range = desc.size,
+					};
+					VkResult result = vkCreateBufferView(device, &viewInfo, nullptr, &currentView);
+					if (result != VK_SUCCESS)
+					{
+						return DetailedResult::Fail(VulkanErrorMsg("vkCreateBufferView", result));
+					}
+
+					currentDescriptor = heap.AllocatePersistent(DescriptorType::Resource);
+					heap.WriteTexelBufferDescriptor(currentDescriptor, VulkanDescriptorType::TypedBuffer_SRV, currentView);
+				}
 			}
 		}
 
@@ -2875,6 +3008,14 @@ namespace ig
 		}
 	}
 
+	uint64_t Buffer::GetGPUAddress() const
+	{
+		VkBufferDeviceAddressInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+		info.buffer = GetVulkanBuffer();
+		return vkGetBufferDeviceAddress(context.GetVulkanDevice(), &info);
+	}
+
 	VkDeviceMemory Buffer::GetVulkanMemory() const
 	{
 		switch (desc.usage)
@@ -3528,6 +3669,7 @@ namespace ig
 			graphicsSpecs.rendererName = props.deviceName;
 			graphicsSpecs.vendorName = GetGpuVendorNameFromID(props.vendorID);
 			graphicsSpecs.maxTextureDimension = props.limits.maxImageDimension2D;
+			graphicsSpecs.maxTypedBufferElements = props.limits.maxTexelBufferElements;
 
 			graphicsSpecs.bufferPlacementAlignments.vertexOrIndexBuffer = 4;
 			graphicsSpecs.bufferPlacementAlignments.rawOrStructuredBuffer = (uint32_t)props.limits.minStorageBufferOffsetAlignment;
@@ -3570,6 +3712,33 @@ namespace ig
 					break;
 				}
 			}
+
+			// Check optional shader features
+			VkPhysicalDeviceVulkan12Features supportedFeats12 = {};
+			supportedFeats12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+			VkPhysicalDeviceFeatures2 supportedFeats2 = {};
+			supportedFeats2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			supportedFeats2.pNext = &supportedFeats12;
+			vkGetPhysicalDeviceFeatures2(graphics.physicalDevice, &supportedFeats2);
+
+			graphicsSpecs.supportedShaderFeatures = SupportedShaderFeatures();
+			graphicsSpecs.supportedShaderFeatures.float16 = (supportedFeats12.shaderFloat16 == VK_TRUE);
+
+			VkPhysicalDeviceVulkan11Properties props11 = {};
+			props11.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES;
+
+			VkPhysicalDeviceProperties2 props2 = {};
+			props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+			props2.pNext = &props11;
+			vkGetPhysicalDeviceProperties2(graphics.physicalDevice, &props2);
+
+			const VkShaderStageFlags waveStages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+			const VkSubgroupFeatureFlags waveOps = VK_SUBGROUP_FEATURE_BASIC_BIT | VK_SUBGROUP_FEATURE_VOTE_BIT |
+				VK_SUBGROUP_FEATURE_ARITHMETIC_BIT | VK_SUBGROUP_FEATURE_BALLOT_BIT | VK_SUBGROUP_FEATURE_SHUFFLE_BIT;
+			graphicsSpecs.supportedShaderFeatures.waveOps =
+				((props11.subgroupSupportedStages & waveStages) == waveStages) &&
+				((props11.subgroupSupportedOperations & waveOps) == waveOps);
 		}
 
 		VulkanQueueFamilies fams = GetVulkanQueueFamilies(graphics.physicalDevice, graphics.surface);
@@ -3641,6 +3810,8 @@ namespace ig
 		feats12.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
 		feats12.descriptorBindingStorageImageUpdateAfterBind = VK_TRUE;
 		feats12.timelineSemaphore = VK_TRUE;
+		feats12.bufferDeviceAddress = VK_TRUE;
+		feats12.shaderFloat16 = graphicsSpecs.supportedShaderFeatures.float16 ? VK_TRUE : VK_FALSE;
 
 		VkPhysicalDeviceFeatures2 feats2 = {};
 		feats2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
@@ -107,7 +107,7 @@ namespace ig
 	};
 
 	//-------------------- Descriptor Heap --------------------//
-	static constexpr uint32_t NUM_VK_DESCRIPTOR_TYPES = 5;
+	static constexpr uint32_t NUM_VK_DESCRIPTOR_TYPES = 6;
 	static constexpr uint32_t VK_BINDING_NON_SAMPLER = 0;
 	static constexpr uint32_t VK_BINDING_SAMPLER = 1;
 	enum class VulkanDescriptorType
@@ -116,6 +116,7 @@ namespace ig
 		RawOrStructuredBuffer_SRV_UAV = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, // SRV or UAV
 		Texture_SRV = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, // SRV
 		Texture_UAV = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, // UAV
+		TypedBuffer_SRV = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, // SRV
 		Sampler = VK_DESCRIPTOR_TYPE_SAMPLER,
 	};
 	static constexpr std::array<VkDescriptorType, NUM_VK_DESCRIPTOR_TYPES> vkDescriptorTypeTable =
@@ -124,6 +125,7 @@ namespace ig
 		VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
 		VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
 		VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+		VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER,
 		VK_DESCRIPTOR_TYPE_SAMPLER
 	};
 	std::array<uint32_t, NUM_VK_DESCRIPTOR_TYPES> GetVulkanPropsMaxDescriptors(VkPhysicalDevice);
@@ -160,6 +162,7 @@ namespace ig
 		Descriptor cbv_srv_uav;
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkBufferView view = VK_NULL_HANDLE; // For typed buffers
 	};
 
 	struct Impl_Buffer
@@ -167,6 +170,7 @@ namespace ig
 		Descriptor cbv_srv_uav;
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkBufferView view = VK_NULL_HANDLE; // For typed buffers
 	};
 
 	struct VulkanQueueFamilies
@@ -207,6 +211,8 @@ namespace ig
 	VulkanTextureFilter ToVulkanTextureFilter(TextureFilter);
 
 	VkPresentModeKHR ToVulkanPresentMode(PresentMode);
+	VkAttachmentLoadOp ToVulkanLoadOp(LoadOp);
+	VkAttachmentStoreOp ToVulkanStoreOp(StoreOp);
 	std::optional<uint32_t> FindVulkanMemoryType(VkPhysicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties);
 	DetailedResult IsVulkanPhysicalDeviceSuitable(VkPhysicalDevice, VkSurfaceKHR, const std::vector<const char*>& requiredDeviceExtensions);
 	uint64_t GetRequiredUploadBufferSize(const Image&, const BufferPlacementAlignments&);
@@ -93,15 +93,15 @@ namespace ig
 
 	const RasterizerDesc RasterizerDesc::NoCull =
 	{
-		false, Cull::Disabled, FrontFace::CW, 0, 0.0f, 0.0f, true, LineRasterizationMode::Smooth, 0, false
+		false, Cull::Disabled, FrontFace::CW, 0, 0.0f, 0.0f, true, LineRasterizationMode::Smooth, 0, false, false
 	};
 	const RasterizerDesc RasterizerDesc::BackCull =
 	{
-		false, Cull::Back, FrontFace::CW, 0, 0.0f, 0.0f, true, LineRasterizationMode::Smooth, 0, false
+		false, Cull::Back, FrontFace::CW, 0, 0.0f, 0.0f, true, LineRasterizationMode::Smooth, 0, false, false
 	};
 	const RasterizerDesc RasterizerDesc::FrontCull =
 	{
-		false, Cull::Front, FrontFace::CW, 0, 0.0f, 0.0f, true, LineRasterizationMode::Smooth, 0, false
+		false, Cull::Front, FrontFace::CW, 0, 0.0f, 0.0f, true, LineRasterizationMode::Smooth, 0, false, false
 	};
 
 	const SamplerDesc SamplerDesc::PixelatedRepeatSampler =
@@ -3021,12 +3021,28 @@ namespace ig
 		case BufferType::StructuredBuffer: errStr = "Failed to create structured buffer. Reason: "; break;
 		case BufferType::RawBuffer:        errStr = "Failed to create raw buffer. Reason: "; break;
 		case BufferType::ShaderConstant:   errStr = "Failed to create shader constant buffer. Reason: "; break;
+		case BufferType::TypedBuffer:      errStr = "Failed to create typed buffer. Reason: "; break;
 
 		default:
 			Log(LogType::Error, ToString(errStr, "Invalid buffer type."));
 			return nullptr;
 		}
 
+		if (desc.type == BufferType::TypedBuffer)
+		{
+			if (desc.usage != BufferUsage::Default &&
+				desc.usage != BufferUsage::Dynamic)
+			{
+				Log(LogType::Error, ToString(errStr, "Only Default and Dynamic usage are supported for typed buffers."));
+				return nullptr;
+			}
+			FormatInfo formatInfo = GetFormatInfo(desc.format);
+			if (formatInfo.bytesPerPixel == 0 || formatInfo.isDepthFormat)
+			{
+				Log(LogType::Error, ToString(errStr, "Format ", GetFormatName(desc.format), " can't be used for typed buffers."));
+				return nullptr;
+			}
+		}
 		if (desc.size == 0)
 		{
 			Log(LogType::Error, ToString(errStr, "Size of buffer can't be zero."));
@@ -3035,9 +3051,10 @@ namespace ig
 		if (desc.usage == BufferUsage::UnorderedAccess)
 		{
 			if (desc.type != BufferType::RawBuffer &&
-				desc.type != BufferType::StructuredBuffer)
+				desc.type != BufferType::StructuredBuffer &&
+				desc.type != BufferType::VertexBuffer)
 			{
-				Log(LogType::Error, ToString(errStr, "Unordered access buffer usage is only supported for raw and structured buffers."));
+				Log(LogType::Error, ToString(errStr, "Unordered access buffer usage is only supported for raw, structured and vertex buffers."));
 				return nullptr;
 			}
 		}
@@ -3159,6 +3176,21 @@ namespace ig
 		return InternalCreate(context, desc);
 	}
 
+	std::unique_ptr<Buffer> Buffer::CreateTypedBuffer(const IGLOContext& context, Format format, uint32_t numElements, BufferUsage usage)
+	{
+		const uint32_t elementStride = GetFormatInfo(format).bytesPerPixel;
+		BufferDesc desc =
+		{
+			.type = BufferType::TypedBuffer,
+			.usage = usage,
+			.size = uint64_t(elementStride) * uint64_t(numElements),
+			.stride = elementStride,
+			.numElements = numElements,
+			.format = format,
+		};
+		return InternalCreate(context, desc);
+	}
+
 	void Buffer::SetData(CommandList& cmd, const void* srcData)
 	{
 		assert((desc.usage == BufferUsage::Default || desc.usage == BufferUsage::UnorderedAccess) &&
@@ -3183,6 +3215,19 @@ namespace ig
 		memcpy(implPerFrame[dynamicSetCounter].mapped, srcData, desc.size);
 	}
 
+	void Buffer::SetDynamicData(const void* srcData, uint64_t numBytes)
+	{
+		assert(desc.usage == BufferUsage::Dynamic && "must have Dynamic usage");
+		assert(numBytes <= desc.size && "can't write past the end of the buffer");
+
+		dynamicSetCounter = (dynamicSetCounter + 1) % GetPerFrameArrayLength();
+
+		assert(implPerFrame);
+		assert(implPerFrame[dynamicSetCounter].mapped);
+
+		memcpy(implPerFrame[dynamicSetCounter].mapped, srcData, numBytes);
+	}
+
 	void Buffer::ReadData(void* destData)
 	{
 		assert(desc.usage == BufferUsage::Readable && "must have Readable usage");
@@ -32,6 +32,7 @@ namespace ig
 	enum class MSAA;
 	enum class PresentMode;
 	struct SupportedPresentModes;
+	struct SupportedShaderFeatures;
 	enum class DisplayMode;
 	enum class TextureWrapMode;
 	enum class PrimitiveTopology;
@@ -57,6 +58,9 @@ namespace ig
 	class Image;
 	enum class TextureUsage;
 	struct ClearValue;
+	enum class LoadOp;
+	enum class StoreOp;
+	struct AttachmentOps;
 	enum class TextureFlags : uint32_t;
 	struct TextureDesc;
 	class Texture;
@@ -253,6 +257,16 @@ namespace ig
 #endif
 	};
 
+	// Optional shader features. Shaders that use them must only be used if they are supported.
+	struct SupportedShaderFeatures
+	{
+		// Native 16-bit float arithmetic (compile with dxc -enable-16bit-types).
+		bool float16 = false;
+
+		// Wave intrinsics (subgroup operations) in vertex, pixel and compute shaders, including WaveReadLaneAt.
+		bool waveOps = false;
+	};
+
 	enum class DisplayMode
 	{
 		Windowed = 0,
@@ -637,6 +651,10 @@ namespace ig
 		unsigned int forcedSampleCount = 0;
 		bool enableConservativeRaster = false;
 
+		// Primitives are discarded right before rasterization. Only the vertex stages run and nothing is drawn.
+		// Useful for measuring vertex processing cost separately from rasterization and pixel shading.
+		bool enableRasterizerDiscard = false;
+
 		// No culling takes place.
 		static const RasterizerDesc NoCull;
 
@@ -1001,6 +1019,35 @@ namespace ig
 		byte stencil = 255;
 	};
 
+	// What happens to the contents of a render pass attachment when the render pass begins.
+	enum class LoadOp
+	{
+		Load = 0, // Previous contents are preserved.
+		Clear, // Cleared to the clear value. Cheaper than a separate ClearColor() or ClearDepth() on tile-based GPUs.
+		DontCare, // Previous contents are undefined. Use this when every pixel will be overwritten.
+	};
+
+	// What happens to the contents of a render pass attachment when the render pass ends.
+	enum class StoreOp
+	{
+		Store = 0, // Rendered contents are written to memory.
+		DontCare, // Rendered contents may be discarded. Use this for attachments that are not read afterwards.
+	};
+
+	// The load and store operations of a single render pass attachment.
+	// On D3D12, LoadOp::DontCare discards the attachment and StoreOp::DontCare is treated as StoreOp::Store,
+	// since iglo binds render targets without D3D12 render passes.
+	// The load op only applies when the render pass begins. Resuming a paused render pass (SafeResumeRenderPass)
+	// always loads the attachments, so they are never cleared or discarded again.
+	// On Vulkan, attachment contents stored with StoreOp::DontCare are lost when pausing a render pass,
+	// so use StoreOp::Store for render passes that may be paused.
+	struct AttachmentOps
+	{
+		LoadOp load = LoadOp::Load;
+		StoreOp store = StoreOp::Store;
+		ClearValue clearValue = ClearValue(); // Used if 'load' is LoadOp::Clear.
+	};
+
 	enum class TextureFlags : uint32_t
 	{
 		None = 0,
@@ -1153,6 +1200,7 @@ namespace ig
 		// The contents of a dynamic buffer is persistent and will last between frames when not updated with new data.
 		// NOTE: The order at which you update and bind the dynamic buffer matters! Correct order: Update->Bind. Wrong order: Bind->Update.
 		// This is because after calling SetDynamicData(), you will get a different descriptor next time you call GetDescriptor().
+		// A dynamic buffer can be the source of CopyBuffer(), which copies the contents set by the latest SetDynamicData().
 		Dynamic,
 
 		// Enables CPU read access.
@@ -1164,6 +1212,8 @@ namespace ig
 		// A buffer with this usage will have both an SRV (for read-only) and a UAV (for read-write or write-only).
 		// Use the SRV descriptor for read operations, and the UAV for read-write or write only operations in shaders.
 		// Remember to use buffer barriers to transition between unordered access and shader resource states as needed.
+		// Vertex buffers with this usage only get a UAV (accessed as a raw buffer in shaders), which allows
+		// a compute shader to write vertices that are later consumed by a regular draw call.
 		UnorderedAccess,
 
 		// 'Temporary' is another buffer usage type that exists, but it's not defined in this enum
@@ -1178,6 +1228,7 @@ namespace ig
 		StructuredBuffer,
 		RawBuffer,
 		ShaderConstant,
+		TypedBuffer,
 	};
 
 	struct BufferDesc
@@ -1187,6 +1238,7 @@ namespace ig
 		uint64_t size = 0; // Total byte size of buffer. No alignment, just the actual data.
 		uint32_t stride = 0; // Stride in bytes.
 		uint32_t numElements = 0;
+		Format format = Format::None; // Element format. Only used by typed buffers.
 	};
 
 	class Buffer
@@ -1206,6 +1258,11 @@ namespace ig
 		static std::unique_ptr<Buffer> CreateRawBuffer(const IGLOContext&, uint64_t numBytes, BufferUsage usage);
 		static std::unique_ptr<Buffer> CreateShaderConstant(const IGLOContext&, uint64_t numBytes, BufferUsage usage);
 
+		// Creates a typed (formatted) buffer. Each element is converted from 'format' when loaded in shaders (Buffer<T> in HLSL).
+		// In Vulkan this is a uniform texel buffer. Only Default and Dynamic usage are supported.
+		// Block compressed and depth formats are not supported.
+		static std::unique_ptr<Buffer> CreateTypedBuffer(const IGLOContext&, Format format, uint32_t numElements, BufferUsage usage);
+
 		// Updates the contents of this buffer.
 		// Default or UnorderedAccess buffer usage is required.
 		// The number of bytes that is read from 'srcData' is equal to the size of this buffer.
@@ -1215,6 +1272,9 @@ namespace ig
 		// Dynamic buffer usage is required.
 		// The number of bytes that is read from 'srcData' is equal to the size of this buffer.
 		void SetDynamicData(const void* srcData);
+		// Same as above, but only the first 'numBytes' bytes of this buffer are updated.
+		// The rest of the buffer is undefined, since each call writes to a different per-frame buffer.
+		void SetDynamicData(const void* srcData, uint64_t numBytes);
 
 		// Reads the contents of this buffer and writes it to the given pointer.
 		// Readable buffer usage is required.
@@ -1227,6 +1287,7 @@ namespace ig
 		BufferType GetType() const { return desc.type; }
 		BufferUsage GetUsage() const { return desc.usage; }
 		uint32_t GetNumElements() const { return desc.numElements; }
+		Format GetFormat() const { return desc.format; }
 
 		// Gets the SRV or CBV descriptor for this buffer (determined by buffer usage).
 		// Aborts if buffer doesn't have an SRV or CBV descriptor.
@@ -1236,11 +1297,16 @@ namespace ig
 		// Aborts if buffer doesn't have a UAV descriptor.
 		Descriptor GetUnorderedAccessDescriptor() const;
 
+		// Gets the GPU virtual address of this buffer (the buffer device address in Vulkan).
+		// For dynamic buffers, the address changes each time you call SetDynamicData(), just like the descriptor.
+		uint64_t GetGPUAddress() const;
+
 #ifdef IGLO_D3D12
 		ID3D12Resource* GetD3D12Resource() const;
 		static D3D12_CONSTANT_BUFFER_VIEW_DESC GenerateD3D12Desc_CBV(ID3D12Resource* bufferLocation, const BufferPlacementAlignments&, uint64_t sizeOfData);
 		static D3D12_SHADER_RESOURCE_VIEW_DESC GenerateD3D12Desc_SRV_Structured(uint32_t numElements, uint32_t stride, uint64_t firstElement = 0);
 		static D3D12_SHADER_RESOURCE_VIEW_DESC GenerateD3D12Desc_SRV_Raw(uint64_t dataSize, uint64_t firstElement = 0);
+		static D3D12_SHADER_RESOURCE_VIEW_DESC GenerateD3D12Desc_SRV_Typed(Format format, uint32_t numElements, uint64_t firstElement = 0);
 		static D3D12_UNORDERED_ACCESS_VIEW_DESC GenerateD3D12Desc_UAV_Structured(uint32_t numElements, uint32_t stride, uint64_t firstElement = 0);
 		static D3D12_UNORDERED_ACCESS_VIEW_DESC GenerateD3D12Desc_UAV_Raw(uint64_t dataSize, uint64_t firstElement = 0);
 #endif
@@ -1487,6 +1553,7 @@ namespace ig
 
 		void WriteBufferDescriptor(Descriptor, VulkanDescriptorType, VkBuffer, VkDeviceSize offset, VkDeviceSize range);
 		void WriteImageDescriptor(Descriptor, VulkanDescriptorType, VkImageView, VkImageLayout);
+		void WriteTexelBufferDescriptor(Descriptor, VulkanDescriptorType, VkBufferView);
 		void WriteSamplerDescriptor(Descriptor, VkSampler);
 #endif
 
@@ -1908,6 +1975,13 @@ namespace ig
 		void BeginRenderPassMultiTarget(const Texture* const* renderTextures, uint32_t numRenderTextures,
 			const Texture* depthBuffer = nullptr, bool optimizedClear = false);
 
+		// Same as above, but with explicit load and store operations for each attachment.
+		// 'colorOps' must point to 'numRenderTextures' elements. 'depthOps' is ignored if 'depthBuffer' is nullptr.
+		void BeginRenderPass(const Texture* renderTexture, AttachmentOps colorOps,
+			const Texture* depthBuffer = nullptr, AttachmentOps depthOps = AttachmentOps());
+		void BeginRenderPassMultiTarget(const Texture* const* renderTextures, const AttachmentOps* colorOps, uint32_t numRenderTextures,
+			const Texture* depthBuffer = nullptr, AttachmentOps depthOps = AttachmentOps());
+
 		void EndRenderPass();
 
 		// SafePauseRenderPass() MUST be followed by a call to SafeResumeRenderPass() in the same function.
@@ -2362,11 +2436,16 @@ namespace ig
 
 		uint32_t maxTextureDimension = 0;
 
+		// The maximum number of elements a typed buffer can have.
+		uint32_t maxTypedBufferElements = 0;
+
 		BufferPlacementAlignments bufferPlacementAlignments;
 
 		// In D3D12, all present modes provided by iglo are guaranteed to be supported.
 		// In Vulkan, only the 'Vsync' present mode is guaranteed to be supported.
 		SupportedPresentModes supportedPresentModes;
+
+		SupportedShaderFeatures supportedShaderFeatures;
 	};
 
 	struct SystemMemoryInfo
@@ -0,0 +1,40 @@
+#include "Common.hlsl"
+
+struct ExpandPushConstants
+{
+	uint srcQuadBufferIndex;
+	uint destVertexBufferIndex;
+	uint numQuads;
+};
+
+[[vk::push_constant]] ConstantBuffer<ExpandPushConstants> pushConstants : register(b0);
+
+[numthreads(64, 1, 1)]
+void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
+{
+	uint quadIndex = dispatchThreadID.x;
+	if (quadIndex >= pushConstants.numQuads) return;
+
+	ByteAddressBuffer quads = ResourceDescriptorHeap[pushConstants.srcQuadBufferIndex];
+	RWByteAddressBuffer vertices = ResourceDescriptorHeap[pushConstants.destVertexBufferIndex];
+
+	uint quadSize = 5 * 4;
+	uint vertexSize = 3 * 4;
+	uint srcOffset = quadSize * quadIndex;
+	uint destOffset = vertexSize * 6 * quadIndex;
+
+	float2 position = asfloat(quads.Load2(srcOffset));
+	float width = asfloat(quads.Load(srcOffset + 8));
+	float height = asfloat(quads.Load(srcOffset + 12));
+	uint color = quads.Load(srcOffset + 16);
+
+	float2 quad[6] = { float2(0, 0), float2(width, 0), float2(0, height),
+					   float2(0, height), float2(width, 0), float2(width, height) };
+
+	[unroll]
+	for (uint i = 0; i < 6; i++)
+	{
+		float2 cornerPos = position + quad[i];
+		vertices.Store3(destOffset + (vertexSize * i), uint3(asuint(cornerPos), color));
+	}
+}
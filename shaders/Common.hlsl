@@ -5,6 +5,15 @@ struct PushConstants
 	float2 screenSize;
 };
 
+// Used by the textured sprite shaders. Must match SpritePushConstants in benchmarks.h.
+struct SpritePushConstants
+{
+	float2 screenSize;
+	uint spriteBufferIndex; // Only used by raw vertex pulling
+	uint textureIndex;
+	uint samplerIndex;
+};
+
 float4 ConvertToFloat4(uint color32)
 {
 	return float4(
@@ -21,3 +30,24 @@ float2 ConvertToScreenSpaceCoords(float2 pos, float2 screenSize)
 	screenPos.y = 1.0 - (pos.y / screenSize.y) * 2.0;
 	return screenPos;
 }
+
+#ifdef HALF_PRECISION
+// 16-bit float versions. Requires -enable-16bit-types.
+float16_t4 ConvertToHalf4(uint color32)
+{
+	return float16_t4(
+		(float16_t)(color32 & 0xFF),
+		(float16_t)((color32 >> 8) & 0xFF),
+		(float16_t)((color32 >> 16) & 0xFF),
+		(float16_t)((color32 >> 24) & 0xFF)) / (float16_t)255.0;
+}
+
+// Pixel positions above 1024 can only be represented in whole pixels.
+float16_t2 ConvertToScreenSpaceCoordsHalf(float16_t2 pos, float16_t2 screenSize)
+{
+	float16_t2 screenPos;
+	screenPos.x = (pos.x / screenSize.x) * (float16_t)2.0 - (float16_t)1.0;
+	screenPos.y = (float16_t)1.0 - (pos.y / screenSize.y) * (float16_t)2.0;
+	return screenPos;
+}
+#endif
@@ -0,0 +1,50 @@
+
+// Same circle math as PS_Circle in iglo, which BatchRenderer::DrawCircle uses.
+// With PREMULTIPLIED_ALPHA, the colors are premultiplied by their alpha and so is the output.
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float2 localPos : TEXCOORD0; // Relative to the circle center, in pixels
+	float radius : RADIUS;
+	float smoothing : SMOOTHING;
+	float borderThickness : BORDERTHICKNESS;
+	float4 innerColor : COLOR0;
+	float4 outerColor : COLOR1;
+	float4 borderColor : COLOR2;
+};
+
+float4 PSMain(PixelInput input) : SV_TARGET
+{
+	float distance = length(input.localPos);
+	float halfBorder = input.borderThickness * 0.5f;
+	float halfSmoothing = input.smoothing * 0.5f;
+	float innerEdge = input.radius - halfBorder;
+	float outerEdge = input.radius + halfBorder;
+
+	// Fully inside, no edge to blend
+	if (distance < innerEdge - halfSmoothing) return lerp(input.innerColor, input.outerColor, distance / input.radius);
+	if (distance > outerEdge + halfSmoothing) return float4(0, 0, 0, 0);
+
+	float4 fill = lerp(input.innerColor, input.outerColor, distance / input.radius);
+	float coverage = 1.0f - smoothstep(input.radius - halfSmoothing, input.radius + halfSmoothing, distance);
+#ifdef PREMULTIPLIED_ALPHA
+	fill *= coverage;
+#else
+	fill.a *= coverage;
+#endif
+	if (input.borderThickness <= 0.0f || input.borderColor.a <= 0.0f) return fill;
+
+	// Blend the border over the fill
+	float borderAmount = smoothstep(innerEdge - halfSmoothing, innerEdge + halfSmoothing, distance) -
+		smoothstep(outerEdge - halfSmoothing, outerEdge + halfSmoothing, distance);
+#ifdef PREMULTIPLIED_ALPHA
+	float4 border = input.borderColor * borderAmount;
+	return border + (fill * (1.0f - border.a));
+#else
+	float4 border = lerp(float4(input.borderColor.rgb, 0.0f), input.borderColor, borderAmount);
+	float alpha = border.a + (fill.a * (1.0f - border.a));
+	float3 rgb = ((border.rgb * border.a) + (fill.rgb * fill.a * (1.0f - border.a))) / alpha;
+	return float4(rgb, alpha);
+#endif
+}
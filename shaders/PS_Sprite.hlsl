@@ -0,0 +1,19 @@
+
+#include "Common.hlsl"
+
+[[vk::push_constant]] ConstantBuffer<SpritePushConstants> pushConstants : register(b0);
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+	float2 uv : TEXCOORD;
+};
+
+float4 PSMain(PixelInput input) : SV_TARGET
+{
+	Texture2D<float4> atlas = ResourceDescriptorHeap[pushConstants.textureIndex];
+	SamplerState atlasSampler = SamplerDescriptorHeap[pushConstants.samplerIndex];
+
+	return atlas.Sample(atlasSampler, input.uv) * input.color;
+}
@@ -0,0 +1,41 @@
+
+#include "Common.hlsl"
+
+// Vulkan only. The quads are read through a buffer device address instead of a descriptor.
+struct AddressPushConstants
+{
+	uint64_t bufferAddress;
+	float2 screenSize;
+};
+
+[[vk::push_constant]] ConstantBuffer<AddressPushConstants> pushConstants : register(b0);
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+};
+
+PixelInput VSMain(uint vertexID : SV_VertexID)
+{
+	uint elementSize = 5 * 4;
+	uint elementIndex = (vertexID / 6);
+	uint cornerIndex = (vertexID % 6);
+	uint64_t address = pushConstants.bufferAddress + (uint64_t)(elementSize * elementIndex);
+
+	float2 position = vk::RawBufferLoad<float2>(address, 4);
+	float width = vk::RawBufferLoad<float>(address + 8, 4);
+	float height = vk::RawBufferLoad<float>(address + 12, 4);
+	uint color = vk::RawBufferLoad<uint>(address + 16, 4);
+
+	float2 quad[6] = { float2(0, 0), float2(width, 0), float2(0, height),
+					   float2(0, height), float2(width, 0), float2(width, height) };
+	float2 cornerPos = float2(position + quad[cornerIndex]);
+	float2 screenPos = ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize);
+
+	PixelInput output;
+	output.position = float4(screenPos, 0.0f, 1.0f);
+	output.color = ConvertToFloat4(color);
+
+	return output;
+}
@@ -0,0 +1,65 @@
+
+#include "Common.hlsl"
+
+struct BillboardPushConstants
+{
+	uint billboardBufferIndex;
+	uint cameraConstantsIndex;
+};
+
+[[vk::push_constant]] ConstantBuffer<BillboardPushConstants> pushConstants : register(b0);
+
+// Uploaded each frame as a temp constant
+struct CameraConstants
+{
+	float4x4 viewProj;
+	float4 cameraRight;
+	float4 cameraUp;
+	float4 frustumPlanes[6]; // Normalized, pointing into the frustum
+};
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+};
+
+PixelInput VSMain(uint vertexID : SV_VertexID)
+{
+	ByteAddressBuffer billboards = ResourceDescriptorHeap[pushConstants.billboardBufferIndex];
+	ConstantBuffer<CameraConstants> camera = ResourceDescriptorHeap[pushConstants.cameraConstantsIndex];
+
+	uint elementIndex = (vertexID / 6);
+	uint cornerIndex = (vertexID % 6);
+	uint byteOffset = elementIndex * 20; // 20 bytes per billboard
+
+	float3 center = asfloat(billboards.Load3(byteOffset));
+	float size = asfloat(billboards.Load(byteOffset + 12));
+	uint color = billboards.Load(byteOffset + 16);
+
+	PixelInput output;
+	output.color = ConvertToFloat4(color);
+
+#ifdef GPU_CULLING
+	// Bounding sphere test. All 6 vertices of a culled billboard end up at the same point, so no pixels are drawn.
+	float radius = size * 0.70710678f;
+	[unroll]
+	for (uint i = 0; i < 6; i++)
+	{
+		if (dot(camera.frustumPlanes[i].xyz, center) + camera.frustumPlanes[i].w < -radius)
+		{
+			output.position = float4(0.0f, 0.0f, 0.0f, 1.0f);
+			return output;
+		}
+	}
+#endif
+
+	float halfSize = size * 0.5f;
+	float2 quad[6] = { float2(-halfSize, -halfSize), float2(halfSize, -halfSize), float2(-halfSize, halfSize),
+					   float2(-halfSize, halfSize), float2(halfSize, -halfSize), float2(halfSize, halfSize) };
+	float3 worldPos = center + (camera.cameraRight.xyz * quad[cornerIndex].x) + (camera.cameraUp.xyz * quad[cornerIndex].y);
+
+	output.position = mul(float4(worldPos, 1.0f), camera.viewProj);
+
+	return output;
+}
@@ -0,0 +1,84 @@
+
+#include "Common.hlsl"
+
+[[vk::push_constant]] ConstantBuffer<PushConstants> pushConstants : register(b0);
+
+// RAW_BUFFER pulls 32 byte circle records (ig::Vertex_Circle) from a raw buffer, 6 vertices per circle.
+// Otherwise, one circle per instance is read from a vertex buffer, 4 vertices per circle (triangle strip).
+
+#ifndef RAW_BUFFER
+struct VertexInput
+{
+	float2 position : POSITION;
+	float radius : RADIUS;
+	float smoothing : SMOOTHING;
+	float borderThickness : BORDERTHICKNESS;
+	float4 innerColor : INNERCOLOR;
+	float4 outerColor : OUTERCOLOR;
+	float4 borderColor : BORDERCOLOR;
+};
+#endif
+
+// Must match PS_CircleSDF.hlsl
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float2 localPos : TEXCOORD0; // Relative to the circle center, in pixels
+	float radius : RADIUS;
+	float smoothing : SMOOTHING;
+	float borderThickness : BORDERTHICKNESS;
+	float4 innerColor : COLOR0;
+	float4 outerColor : COLOR1;
+	float4 borderColor : COLOR2;
+};
+
+#ifdef RAW_BUFFER
+PixelInput VSMain(uint vertexID : SV_VertexID)
+{
+	ByteAddressBuffer buffer = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
+
+	uint elementIndex = (vertexID / 6);
+	uint cornerIndex = (vertexID % 6);
+	uint byteOffset = elementIndex * 32; // 32 bytes per circle
+
+	float4 first = asfloat(buffer.Load4(byteOffset)); // x, y, radius, smoothing
+	float borderThickness = asfloat(buffer.Load(byteOffset + 16));
+	uint3 colors = buffer.Load3(byteOffset + 20); // inner, outer, border
+
+	float extent = first.z + (borderThickness * 0.5f) + (first.w * 0.5f);
+	float2 quad[6] = { float2(-extent, -extent), float2(extent, -extent), float2(-extent, extent),
+					   float2(-extent, extent), float2(extent, -extent), float2(extent, extent) };
+	float2 localPos = quad[cornerIndex];
+
+	PixelInput output;
+	output.position = float4(ConvertToScreenSpaceCoords(first.xy + localPos, pushConstants.screenSize), 0.0f, 1.0f);
+	output.localPos = localPos;
+	output.radius = first.z;
+	output.smoothing = first.w;
+	output.borderThickness = borderThickness;
+	output.innerColor = ConvertToFloat4(colors.x);
+	output.outerColor = ConvertToFloat4(colors.y);
+	output.borderColor = ConvertToFloat4(colors.z);
+
+	return output;
+}
+#else
+PixelInput VSMain(VertexInput input, uint vertexID : SV_VertexID)
+{
+	float extent = input.radius + (input.borderThickness * 0.5f) + (input.smoothing * 0.5f);
+	float2 quad[4] = { float2(-extent, -extent), float2(extent, -extent), float2(-extent, extent), float2(extent, extent) };
+	float2 localPos = quad[vertexID];
+
+	PixelInput output;
+	output.position = float4(ConvertToScreenSpaceCoords(input.position + localPos, pushConstants.screenSize), 0.0f, 1.0f);
+	output.localPos = localPos;
+	output.radius = input.radius;
+	output.smoothing = input.smoothing;
+	output.borderThickness = input.borderThickness;
+	output.innerColor = input.innerColor;
+	output.outerColor = input.outerColor;
+	output.borderColor = input.borderColor;
+
+	return output;
+}
+#endif
@@ -0,0 +1,44 @@
+#include "Common.hlsl"
+
+// 'rawOrStructuredBufferIndex' holds the index of the constant buffer chunk.
+[[vk::push_constant]] ConstantBuffer<PushConstants> pushConstants : register(b0);
+
+// A 64 KB chunk of tightly packed quads (5 uints per quad). The last chunk is zero padded to the full size.
+struct QuadChunk
+{
+	uint4 data[4096];
+};
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+};
+
+PixelInput VSMain(uint vertexID : SV_VertexID, uint instanceID : SV_InstanceID)
+{
+	ConstantBuffer<QuadChunk> chunk = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
+
+	uint words[5];
+	[unroll]
+	for (uint i = 0; i < 5; i++)
+	{
+		uint wordIndex = (instanceID * 5) + i;
+		words[i] = chunk.data[wordIndex / 4][wordIndex % 4];
+	}
+
+	float2 position = asfloat(uint2(words[0], words[1]));
+	float width = asfloat(words[2]);
+	float height = asfloat(words[3]);
+	uint color = words[4];
+
+	float2 quad[4] = { float2(0, 0), float2(width, 0), float2(0, height), float2(width, height) };
+	float2 cornerPos = float2(position + quad[vertexID]);
+	float2 screenPos = ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize);
+
+	PixelInput output;
+	output.position = float4(screenPos, 0.0f, 1.0f);
+	output.color = ConvertToFloat4(color);
+
+	return output;
+}
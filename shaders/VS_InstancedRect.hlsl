@@ -21,9 +21,18 @@ PixelInput VSMain(VertexInput input, uint vertexID : SV_VertexID)
 {
 	PixelInput output;
 
+#ifdef HALF_PRECISION
+	// Vertex inputs stay 32-bit, the arithmetic is done in 16-bit
+	float16_t width = (float16_t)input.width;
+	float16_t height = (float16_t)input.height;
+	float16_t2 quad[4] = { float16_t2(0, 0), float16_t2(width, 0), float16_t2(0, height), float16_t2(width, height) };
+	float16_t2 cornerPos = (float16_t2)input.position + quad[vertexID];
+	float16_t2 screenPos = ConvertToScreenSpaceCoordsHalf(cornerPos, (float16_t2)pushConstants.screenSize);
+#else
 	float2 quad[4] = { float2(0, 0), float2(input.width, 0), float2(0, input.height), float2(input.width, input.height) };
 	float2 cornerPos = float2(input.position + quad[vertexID]);
 	float2 screenPos = ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize);
+#endif
 
 	output.position = float4(screenPos, 0.0f, 1.0f);
 	output.color = input.color;
@@ -0,0 +1,60 @@
+
+#include "Common.hlsl"
+
+struct ProceduralPushConstants
+{
+	uint seed;
+	float quadSize;
+	float2 screenSize;
+};
+
+[[vk::push_constant]] ConstantBuffer<ProceduralPushConstants> pushConstants : register(b0);
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+};
+
+// PCG integer hash
+uint Hash(uint input)
+{
+	uint state = input * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+float HashToUnitFloat(uint hash)
+{
+	return (float)(hash >> 8) / 16777216.0f; // 24 bits of precision, range [0, 1)
+}
+
+PixelInput VSMain(uint vertexID : SV_VertexID)
+{
+	uint elementIndex = (vertexID / 6);
+	uint cornerIndex = (vertexID % 6);
+
+	// Same distribution as the CPU generated quads, but nothing is read from memory
+	uint hashX = Hash(elementIndex ^ pushConstants.seed);
+	uint hashY = Hash(hashX);
+	uint color = Hash(hashY);
+
+	float2 maxPos = pushConstants.screenSize - pushConstants.quadSize;
+	float2 position = float2(HashToUnitFloat(hashX), HashToUnitFloat(hashY)) * maxPos;
+	float size = pushConstants.quadSize;
+
+	float2 quad[6] = { float2(0, 0), float2(size, 0), float2(0, size),
+					   float2(0, size), float2(size, 0), float2(size, size) };
+	float2 cornerPos = position + quad[cornerIndex];
+	float2 screenPos = ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize);
+
+	PixelInput output;
+	output.position = float4(screenPos, 0.0f, 1.0f);
+	output.color = ConvertToFloat4(color);
+#ifdef PREMULTIPLIED_ALPHA
+	// Premultiplied like the CPU generated quad colors in premultiplied alpha runs
+	output.color.rgb *= output.color.a;
+#endif
+
+	return output;
+}
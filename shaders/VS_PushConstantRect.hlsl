@@ -0,0 +1,37 @@
+
+#include "Common.hlsl"
+
+// The quad is passed directly through push constants, so no buffers or vertex inputs are needed.
+struct QuadPushConstants
+{
+	float2 screenSize;
+	float2 position;
+	float width;
+	float height;
+	uint color;
+};
+
+[[vk::push_constant]] ConstantBuffer<QuadPushConstants> pushConstants : register(b0);
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+};
+
+PixelInput VSMain(uint vertexID : SV_VertexID)
+{
+	float width = pushConstants.width;
+	float height = pushConstants.height;
+
+	float2 quad[6] = { float2(0, 0), float2(width, 0), float2(0, height),
+					   float2(0, height), float2(width, 0), float2(width, height) };
+	float2 cornerPos = float2(pushConstants.position + quad[vertexID]);
+	float2 screenPos = ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize);
+
+	PixelInput output;
+	output.position = float4(screenPos, 0.0f, 1.0f);
+	output.color = ConvertToFloat4(pushConstants.color);
+
+	return output;
+}
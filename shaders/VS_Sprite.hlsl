@@ -0,0 +1,83 @@
+
+#include "Common.hlsl"
+
+[[vk::push_constant]] ConstantBuffer<SpritePushConstants> pushConstants : register(b0);
+
+// RAW_BUFFER pulls 36 byte sprite records from a raw buffer, 6 vertices per sprite.
+// INSTANCED reads one sprite per instance from a vertex buffer, 4 vertices per sprite (triangle strip).
+// Otherwise, each vertex of a triangle list is read from a vertex buffer.
+
+#ifdef INSTANCED
+struct VertexInput
+{
+	float2 position : POSITION;
+	float width : WIDTH;
+	float height : HEIGHT;
+	float4 uvRect : UVRECT; // left, top, right, bottom
+	float4 color : COLOR;
+};
+#elif !defined(RAW_BUFFER)
+struct VertexInput
+{
+	float2 position : POSITION;
+	float2 uv : TEXCOORD;
+	float4 color : COLOR;
+};
+#endif
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+	float2 uv : TEXCOORD;
+};
+
+#ifdef RAW_BUFFER
+PixelInput VSMain(uint vertexID : SV_VertexID)
+{
+	ByteAddressBuffer buffer = ResourceDescriptorHeap[pushConstants.spriteBufferIndex];
+
+	uint elementIndex = (vertexID / 6);
+	uint cornerIndex = (vertexID % 6);
+	uint byteOffset = elementIndex * 36; // 36 bytes per sprite
+
+	float4 rect = asfloat(buffer.Load4(byteOffset)); // x, y, width, height
+	float4 uvRect = asfloat(buffer.Load4(byteOffset + 16));
+	uint color = buffer.Load(byteOffset + 32);
+
+	float2 corners[6] = { float2(0, 0), float2(1, 0), float2(0, 1), float2(0, 1), float2(1, 0), float2(1, 1) };
+	float2 corner = corners[cornerIndex];
+	float2 cornerPos = rect.xy + (rect.zw * corner);
+
+	PixelInput output;
+	output.position = float4(ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize), 0.0f, 1.0f);
+	output.color = ConvertToFloat4(color);
+	output.uv = lerp(uvRect.xy, uvRect.zw, corner);
+
+	return output;
+}
+#elif defined(INSTANCED)
+PixelInput VSMain(VertexInput input, uint vertexID : SV_VertexID)
+{
+	float2 corners[4] = { float2(0, 0), float2(1, 0), float2(0, 1), float2(1, 1) };
+	float2 corner = corners[vertexID];
+	float2 cornerPos = input.position + (float2(input.width, input.height) * corner);
+
+	PixelInput output;
+	output.position = float4(ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize), 0.0f, 1.0f);
+	output.color = input.color;
+	output.uv = lerp(input.uvRect.xy, input.uvRect.zw, corner);
+
+	return output;
+}
+#else
+PixelInput VSMain(VertexInput input)
+{
+	PixelInput output;
+	output.position = float4(ConvertToScreenSpaceCoords(input.position, pushConstants.screenSize), 0.0f, 1.0f);
+	output.color = input.color;
+	output.uv = input.uv;
+
+	return output;
+}
+#endif
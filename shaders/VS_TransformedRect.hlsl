@@ -0,0 +1,41 @@
+
+#include "Common.hlsl"
+
+[[vk::push_constant]] ConstantBuffer<PushConstants> pushConstants : register(b0);
+
+struct PixelInput
+{
+	float4 position : SV_POSITION;
+	float4 color : COLOR;
+};
+
+PixelInput VSMain(uint vertexID : SV_VertexID)
+{
+	ByteAddressBuffer buffer = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
+
+	uint elementIndex = (vertexID / 6);
+	uint cornerIndex = (vertexID % 6);
+	uint byteOffset = elementIndex * 24; // 24 bytes per transformed quad
+
+	float4 rect = asfloat(buffer.Load4(byteOffset)); // x, y, width, height
+	float rotation = asfloat(buffer.Load(byteOffset + 16));
+	uint color = buffer.Load(byteOffset + 20);
+
+	// Rotate the corner around the center of the quad
+	float2 halfSize = rect.zw * 0.5f;
+	float2 quad[6] = { float2(-halfSize.x, -halfSize.y), float2(halfSize.x, -halfSize.y), float2(-halfSize.x, halfSize.y),
+					   float2(-halfSize.x, halfSize.y), float2(halfSize.x, -halfSize.y), float2(halfSize.x, halfSize.y) };
+	float2 local = quad[cornerIndex];
+	float s, c;
+	sincos(rotation, s, c);
+	float2 rotated = float2((local.x * c) - (local.y * s), (local.x * s) + (local.y * c));
+
+	float2 cornerPos = rect.xy + halfSize + rotated;
+	float2 screenPos = ConvertToScreenSpaceCoords(cornerPos, pushConstants.screenSize);
+
+	PixelInput output;
+	output.position = float4(screenPos, 0.0f, 1.0f);
+	output.color = ConvertToFloat4(color);
+
+	return output;
+}
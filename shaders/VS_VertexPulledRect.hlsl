@@ -3,6 +3,34 @@
 
 [[vk::push_constant]] ConstantBuffer<PushConstants> pushConstants : register(b0);
 
+#ifdef TEXTURE
+static const uint textureQuadsPerRow = 2048; // Must match textureQuadsPerRow in benchmarks.h
+#endif
+
+// RECORD_SIZE selects the quad layout used by raw and structured buffers.
+// Must match PackedQuad16 and AlignedQuad32 in benchmarks.h.
+#ifndef RECORD_SIZE
+#define RECORD_SIZE 20
+#endif
+
+#if RECORD_SIZE == 16
+struct QuadRecord
+{
+	float2 position;
+	uint packedSize; // Width in the low 16 bits, height in the high 16 bits
+	uint color;
+};
+#elif RECORD_SIZE == 32
+struct QuadRecord
+{
+	float2 position;
+	float width;
+	float height;
+	uint color;
+	uint3 padding;
+};
+#endif
+
 struct VertexInput
 {
 	float2 position;
@@ -25,14 +53,26 @@ struct PixelInput
 PixelInput VSMain(uint vertexID : SV_VertexID)
 {
 #ifdef STRUCTURED_BUFFER
+#if RECORD_SIZE == 20
 	StructuredBuffer<VertexInput> buffer = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
+#else
+	StructuredBuffer<QuadRecord> buffer = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
+#endif
 #endif
 
 #ifdef RAW_BUFFER
 	ByteAddressBuffer buffer = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
 #endif
 
-	uint elementSize = 5 * 4;
+#ifdef TYPED_BUFFER
+	Buffer<uint> buffer = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
+#endif
+
+#ifdef TEXTURE
+	Texture2D<uint> texture = ResourceDescriptorHeap[pushConstants.rawOrStructuredBufferIndex];
+#endif
+
+	uint elementSize = RECORD_SIZE;
 	uint elementIndex = (vertexID / 6);
 	uint cornerIndex = (vertexID % 6);
 	uint offset = elementSize * elementIndex;
@@ -40,16 +80,116 @@ PixelInput VSMain(uint vertexID : SV_VertexID)
 	VertexInput input;
 
 #ifdef RAW_BUFFER
+#if RECORD_SIZE == 16
+	uint4 data = buffer.Load4(offset);
+	input.position = asfloat(data.xy);
+	input.width = (float)(data.z & 0xFFFF);
+	input.height = (float)(data.z >> 16);
+	input.color = data.w;
+#elif RECORD_SIZE == 32
+	uint4 data0 = buffer.Load4(offset);
+	uint4 data1 = buffer.Load4(offset + 16);
+	input.position = asfloat(data0.xy);
+	input.width = asfloat(data0.z);
+	input.height = asfloat(data0.w);
+	input.color = data1.x;
+#elif defined(WAVE_SHARED_LOAD)
+	// Only the first vertex of each quad loads the quad, the other vertices read it from that lane.
+	// This assumes the vertices of a quad land in consecutive lanes. If the first vertex of a quad is not an active
+	// lane of this wave (the quad straddles the wave or the active mask), its other vertices load the quad themselves.
+	// Inactive lanes are never read: lanes without an active first lane read their own lane instead.
+	uint laneIndex = WaveGetLaneIndex();
+	uint4 activeMask = WaveActiveBallot(true);
+	bool firstLaneInWave = (laneIndex >= cornerIndex);
+	uint firstLane = firstLaneInWave ? (laneIndex - cornerIndex) : laneIndex;
+	bool firstLaneActive = firstLaneInWave && (((activeMask[firstLane / 32] >> (firstLane % 32)) & 1) != 0);
+	uint readLane = firstLaneActive ? firstLane : laneIndex;
+
+	uint4 data = 0;
+	uint color = 0;
+	if (cornerIndex == 0)
+	{
+		data = buffer.Load4(offset);
+		color = buffer.Load(offset + 16);
+	}
+	uint4 sharedData = WaveReadLaneAt(data, readLane);
+	uint sharedColor = WaveReadLaneAt(color, readLane);
+	uint sharedVertexID = WaveReadLaneAt(vertexID, readLane);
+
+	if (cornerIndex != 0)
+	{
+		if (firstLaneActive && (sharedVertexID == (vertexID - cornerIndex)))
+		{
+			data = sharedData;
+			color = sharedColor;
+		}
+		else
+		{
+			data = buffer.Load4(offset);
+			color = buffer.Load(offset + 16);
+		}
+	}
+
+	input.position = asfloat(data.xy);
+	input.width = asfloat(data.z);
+	input.height = asfloat(data.w);
+	input.color = color;
+#else
 	input.position = asfloat(buffer.Load2(offset));
 	input.width = asfloat(buffer.Load(offset + 8));
 	input.height = asfloat(buffer.Load(offset + 12));
 	input.color = buffer.Load(offset + 16);
 #endif
+#endif
 
 #ifdef STRUCTURED_BUFFER
+#if RECORD_SIZE == 16
+	QuadRecord record = buffer[elementIndex];
+	input.position = record.position;
+	input.width = (float)(record.packedSize & 0xFFFF);
+	input.height = (float)(record.packedSize >> 16);
+	input.color = record.color;
+#elif RECORD_SIZE == 32
+	QuadRecord record = buffer[elementIndex];
+	input.position = record.position;
+	input.width = record.width;
+	input.height = record.height;
+	input.color = record.color;
+#else
 	input = buffer[elementIndex];
 #endif
+#endif
 
+#ifdef TYPED_BUFFER
+	uint firstElement = elementIndex * 5;
+	input.position = asfloat(uint2(buffer[firstElement], buffer[firstElement + 1]));
+	input.width = asfloat(buffer[firstElement + 2]);
+	input.height = asfloat(buffer[firstElement + 3]);
+	input.color = buffer[firstElement + 4];
+#endif
+
+#ifdef TEXTURE
+	// Each quad takes up 5 texels in a row.
+	int3 texel = int3((elementIndex % textureQuadsPerRow) * 5, elementIndex / textureQuadsPerRow, 0);
+	input.position = asfloat(uint2(texture.Load(texel), texture.Load(texel + int3(1, 0, 0))));
+	input.width = asfloat(texture.Load(texel + int3(2, 0, 0)));
+	input.height = asfloat(texture.Load(texel + int3(3, 0, 0)));
+	input.color = texture.Load(texel + int3(4, 0, 0));
+#endif
+
+#ifdef HALF_PRECISION
+	// Decode the quad with 16-bit arithmetic
+	float16_t width = (float16_t)input.width;
+	float16_t height = (float16_t)input.height;
+	float16_t2 quad[6] = { float16_t2(0, 0), float16_t2(width, 0), float16_t2(0, height),
+						   float16_t2(0, height), float16_t2(width, 0), float16_t2(width, height) };
+	float16_t2 cornerPos = (float16_t2)input.position + quad[cornerIndex];
+	float16_t2 screenPos = ConvertToScreenSpaceCoordsHalf(cornerPos, (float16_t2)pushConstants.screenSize);
+
+	PixelInput output;
+	output.position = float4(screenPos, 0.0f, 1.0f);
+	output.color = ConvertToHalf4(input.color);
+#else
 	float2 quad[6] = { float2(0, 0), float2(input.width, 0), float2(0, input.height),
 					   float2(0, input.height), float2(input.width, 0), float2(input.width, input.height) };
 	float2 cornerPos = float2(input.position + quad[cornerIndex]);
@@ -58,6 +198,7 @@ PixelInput VSMain(uint vertexID : SV_VertexID)
 	PixelInput output;
 	output.position = float4(screenPos, 0.0f, 1.0f);
 	output.color = ConvertToFloat4(input.color);
+#endif
 
 	return output;
 }
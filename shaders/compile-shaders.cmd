@@ -1,13 +1,64 @@
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRect" -Fh "../src/shaders/VS_RawRect.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRect16" -Fh "../src/shaders/VS_RawRect16.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D RECORD_SIZE=16 -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRect32" -Fh "../src/shaders/VS_RawRect32.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D RECORD_SIZE=32 -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRectHalf" -Fh "../src/shaders/VS_RawRectHalf.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D HALF_PRECISION -enable-16bit-types -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRectWave" -Fh "../src/shaders/VS_RawRectWave.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D WAVE_SHARED_LOAD -Qstrip_reflect -Wno-ignored-attributes
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_StructuredRect" -Fh "../src/shaders/VS_StructuredRect.h" "VS_VertexPulledRect.hlsl" -D STRUCTURED_BUFFER -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_StructuredRect16" -Fh "../src/shaders/VS_StructuredRect16.h" "VS_VertexPulledRect.hlsl" -D STRUCTURED_BUFFER -D RECORD_SIZE=16 -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_StructuredRect32" -Fh "../src/shaders/VS_StructuredRect32.h" "VS_VertexPulledRect.hlsl" -D STRUCTURED_BUFFER -D RECORD_SIZE=32 -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_TypedRect" -Fh "../src/shaders/VS_TypedRect.h" "VS_VertexPulledRect.hlsl" -D TYPED_BUFFER -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_TextureRect" -Fh "../src/shaders/VS_TextureRect.h" "VS_VertexPulledRect.hlsl" -D TEXTURE -Qstrip_reflect -Wno-ignored-attributes
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_InstancedRect" -Fh "../src/shaders/VS_InstancedRect.h" "VS_InstancedRect.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_InstancedRectHalf" -Fh "../src/shaders/VS_InstancedRectHalf.h" "VS_InstancedRect.hlsl" -D HALF_PRECISION -enable-16bit-types -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_ProceduralRect" -Fh "../src/shaders/VS_ProceduralRect.h" "VS_ProceduralRect.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_ProceduralRectPremultiplied" -Fh "../src/shaders/VS_ProceduralRectPremultiplied.h" "VS_ProceduralRect.hlsl" -D PREMULTIPLIED_ALPHA -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_ConstantBufferRect" -Fh "../src/shaders/VS_ConstantBufferRect.h" "VS_ConstantBufferRect.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_PushConstantRect" -Fh "../src/shaders/VS_PushConstantRect.h" "VS_PushConstantRect.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_BillboardRect" -Fh "../src/shaders/VS_BillboardRect.h" "VS_BillboardRect.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_BillboardRectCulled" -Fh "../src/shaders/VS_BillboardRectCulled.h" "VS_BillboardRect.hlsl" -D GPU_CULLING -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_TransformedRect" -Fh "../src/shaders/VS_TransformedRect.h" "VS_TransformedRect.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_SpriteRaw" -Fh "../src/shaders/VS_SpriteRaw.h" "VS_Sprite.hlsl" -D RAW_BUFFER -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_SpriteInstanced" -Fh "../src/shaders/VS_SpriteInstanced.h" "VS_Sprite.hlsl" -D INSTANCED -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_SpriteTriangles" -Fh "../src/shaders/VS_SpriteTriangles.h" "VS_Sprite.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_Sprite" -Fh "../src/shaders/PS_Sprite.h" "PS_Sprite.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_CircleRaw" -Fh "../src/shaders/VS_CircleRaw.h" "VS_Circle.hlsl" -D RAW_BUFFER -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_CircleInstanced" -Fh "../src/shaders/VS_CircleInstanced.h" "VS_Circle.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_CircleSDF" -Fh "../src/shaders/PS_CircleSDF.h" "PS_CircleSDF.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_CircleSDFPremultiplied" -Fh "../src/shaders/PS_CircleSDFPremultiplied.h" "PS_CircleSDF.hlsl" -D PREMULTIPLIED_ALPHA -Qstrip_reflect -Wno-ignored-attributes
 dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_Color" -Fh "../src/shaders/PS_Color.h" "PS_Color.hlsl" -Qstrip_reflect -Wno-ignored-attributes
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_Triangles" -Fh "../src/shaders/VS_Triangles.h" "VS_Triangles.hlsl" -Qstrip_reflect -Wno-ignored-attributes
+dxc.exe -WX -Qstrip_debug -T cs_6_6 -E CSMain -Vn "g_CS_ExpandQuads" -Fh "../src/shaders/CS_ExpandQuads.h" "CS_ExpandQuads.hlsl" -Qstrip_reflect -Wno-ignored-attributes
 
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_AddressRect" -Fh "../src/shaders/VS_AddressRect_SPIRV.h" "VS_AddressRect.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRect" -Fh "../src/shaders/VS_RawRect_SPIRV.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRect16" -Fh "../src/shaders/VS_RawRect16_SPIRV.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D RECORD_SIZE=16 -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRect32" -Fh "../src/shaders/VS_RawRect32_SPIRV.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D RECORD_SIZE=32 -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRectHalf" -Fh "../src/shaders/VS_RawRectHalf_SPIRV.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D HALF_PRECISION -enable-16bit-types -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_RawRectWave" -Fh "../src/shaders/VS_RawRectWave_SPIRV.h" "VS_VertexPulledRect.hlsl" -D RAW_BUFFER -D WAVE_SHARED_LOAD -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_StructuredRect" -Fh "../src/shaders/VS_StructuredRect_SPIRV.h" "VS_VertexPulledRect.hlsl" -D STRUCTURED_BUFFER -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_StructuredRect16" -Fh "../src/shaders/VS_StructuredRect16_SPIRV.h" "VS_VertexPulledRect.hlsl" -D STRUCTURED_BUFFER -D RECORD_SIZE=16 -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_StructuredRect32" -Fh "../src/shaders/VS_StructuredRect32_SPIRV.h" "VS_VertexPulledRect.hlsl" -D STRUCTURED_BUFFER -D RECORD_SIZE=32 -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_TypedRect" -Fh "../src/shaders/VS_TypedRect_SPIRV.h" "VS_VertexPulledRect.hlsl" -D TYPED_BUFFER -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_TextureRect" -Fh "../src/shaders/VS_TextureRect_SPIRV.h" "VS_VertexPulledRect.hlsl" -D TEXTURE -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_InstancedRect" -Fh "../src/shaders/VS_InstancedRect_SPIRV.h" "VS_InstancedRect.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_InstancedRectHalf" -Fh "../src/shaders/VS_InstancedRectHalf_SPIRV.h" "VS_InstancedRect.hlsl" -D HALF_PRECISION -enable-16bit-types -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_ProceduralRect" -Fh "../src/shaders/VS_ProceduralRect_SPIRV.h" "VS_ProceduralRect.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_ProceduralRectPremultiplied" -Fh "../src/shaders/VS_ProceduralRectPremultiplied_SPIRV.h" "VS_ProceduralRect.hlsl" -D PREMULTIPLIED_ALPHA -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_ConstantBufferRect" -Fh "../src/shaders/VS_ConstantBufferRect_SPIRV.h" "VS_ConstantBufferRect.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_PushConstantRect" -Fh "../src/shaders/VS_PushConstantRect_SPIRV.h" "VS_PushConstantRect.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_BillboardRect" -Fh "../src/shaders/VS_BillboardRect_SPIRV.h" "VS_BillboardRect.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_BillboardRectCulled" -Fh "../src/shaders/VS_BillboardRectCulled_SPIRV.h" "VS_BillboardRect.hlsl" -D GPU_CULLING -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_TransformedRect" -Fh "../src/shaders/VS_TransformedRect_SPIRV.h" "VS_TransformedRect.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_SpriteRaw" -Fh "../src/shaders/VS_SpriteRaw_SPIRV.h" "VS_Sprite.hlsl" -D RAW_BUFFER -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_SpriteInstanced" -Fh "../src/shaders/VS_SpriteInstanced_SPIRV.h" "VS_Sprite.hlsl" -D INSTANCED -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_SpriteTriangles" -Fh "../src/shaders/VS_SpriteTriangles_SPIRV.h" "VS_Sprite.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_Sprite" -Fh "../src/shaders/PS_Sprite_SPIRV.h" "PS_Sprite.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_CircleRaw" -Fh "../src/shaders/VS_CircleRaw_SPIRV.h" "VS_Circle.hlsl" -D RAW_BUFFER -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_CircleInstanced" -Fh "../src/shaders/VS_CircleInstanced_SPIRV.h" "VS_Circle.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_CircleSDF" -Fh "../src/shaders/PS_CircleSDF_SPIRV.h" "PS_CircleSDF.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_CircleSDFPremultiplied" -Fh "../src/shaders/PS_CircleSDFPremultiplied_SPIRV.h" "PS_CircleSDF.hlsl" -D PREMULTIPLIED_ALPHA -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
 dxc.exe -WX -Qstrip_debug -T ps_6_6 -E PSMain -Vn "g_PS_Color" -Fh "../src/shaders/PS_Color_SPIRV.h" "PS_Color.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
 dxc.exe -WX -Qstrip_debug -T vs_6_6 -E VSMain -Vn "g_VS_Triangles" -Fh "../src/shaders/VS_Triangles_SPIRV.h" "VS_Triangles.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
+dxc.exe -WX -Qstrip_debug -T cs_6_6 -E CSMain -Vn "g_CS_ExpandQuads" -Fh "../src/shaders/CS_ExpandQuads_SPIRV.h" "CS_ExpandQuads.hlsl" -D VULKAN -spirv -fspv-target-env=vulkan1.3 -fvk-use-dx-layout -fvk-bind-resource-heap 0 0 -fvk-bind-sampler-heap 1 0
 
 pause
\ No newline at end of file
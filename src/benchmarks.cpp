@@ -2,23 +2,144 @@
 #include "benchmarks.h"
 
 #ifdef IGLO_D3D12
+#include "shaders/CS_ExpandQuads.h"
+#include "shaders/PS_CircleSDF.h"
+#include "shaders/PS_CircleSDFPremultiplied.h"
 #include "shaders/PS_Color.h"
+#include "shaders/PS_Sprite.h"
+#include "shaders/VS_BillboardRect.h"
+#include "shaders/VS_BillboardRectCulled.h"
+#include "shaders/VS_CircleInstanced.h"
+#include "shaders/VS_CircleRaw.h"
+#include "shaders/VS_ConstantBufferRect.h"
 #include "shaders/VS_InstancedRect.h"
+#include "shaders/VS_InstancedRectHalf.h"
+#include "shaders/VS_ProceduralRect.h"
+#include "shaders/VS_ProceduralRectPremultiplied.h"
+#include "shaders/VS_PushConstantRect.h"
 #include "shaders/VS_RawRect.h"
+#include "shaders/VS_RawRect16.h"
+#include "shaders/VS_RawRect32.h"
+#include "shaders/VS_RawRectHalf.h"
+#include "shaders/VS_RawRectWave.h"
+#include "shaders/VS_SpriteInstanced.h"
+#include "shaders/VS_SpriteRaw.h"
+#include "shaders/VS_SpriteTriangles.h"
 #include "shaders/VS_StructuredRect.h"
+#include "shaders/VS_StructuredRect16.h"
+#include "shaders/VS_StructuredRect32.h"
+#include "shaders/VS_TextureRect.h"
+#include "shaders/VS_TransformedRect.h"
 #include "shaders/VS_Triangles.h"
+#include "shaders/VS_TypedRect.h"
 #else
+#include "shaders/CS_ExpandQuads_SPIRV.h"
+#include "shaders/PS_CircleSDF_SPIRV.h"
+#include "shaders/PS_CircleSDFPremultiplied_SPIRV.h"
 #include "shaders/PS_Color_SPIRV.h"
+#include "shaders/PS_Sprite_SPIRV.h"
+#include "shaders/VS_AddressRect_SPIRV.h" // Vulkan only
+#include "shaders/VS_BillboardRect_SPIRV.h"
+#include "shaders/VS_BillboardRectCulled_SPIRV.h"
+#include "shaders/VS_CircleInstanced_SPIRV.h"
+#include "shaders/VS_CircleRaw_SPIRV.h"
+#include "shaders/VS_ConstantBufferRect_SPIRV.h"
 #include "shaders/VS_InstancedRect_SPIRV.h"
+#include "shaders/VS_InstancedRectHalf_SPIRV.h"
+#include "shaders/VS_ProceduralRect_SPIRV.h"
+#include "shaders/VS_ProceduralRectPremultiplied_SPIRV.h"
+#include "shaders/VS_PushConstantRect_SPIRV.h"
 #include "shaders/VS_RawRect_SPIRV.h"
+#include "shaders/VS_RawRect16_SPIRV.h"
+#include "shaders/VS_RawRect32_SPIRV.h"
+#include "shaders/VS_RawRectHalf_SPIRV.h"
+#include "shaders/VS_RawRectWave_SPIRV.h"
+#include "shaders/VS_SpriteInstanced_SPIRV.h"
+#include "shaders/VS_SpriteRaw_SPIRV.h"
+#include "shaders/VS_SpriteTriangles_SPIRV.h"
 #include "shaders/VS_StructuredRect_SPIRV.h"
+#include "shaders/VS_StructuredRect16_SPIRV.h"
+#include "shaders/VS_StructuredRect32_SPIRV.h"
+#include "shaders/VS_TextureRect_SPIRV.h"
+#include "shaders/VS_TransformedRect_SPIRV.h"
 #include "shaders/VS_Triangles_SPIRV.h"
+#include "shaders/VS_TypedRect_SPIRV.h"
 #endif
 
 #define SHADER_VS(a) ig::Shader(a, sizeof(a), "VSMain")
 #define SHADER_PS(a) ig::Shader(a, sizeof(a), "PSMain")
+#define SHADER_CS(a) ig::Shader(a, sizeof(a), "CSMain")
 
-void UpdateQuadsCPU(ig::Extent2D viewExtent, Quad* quads_CPU, uint32_t numQuads)
+// Interleaves the bits of the pixel coordinates (Z-order curve).
+static uint32_t GetMortonCode(float x, float y)
+{
+	auto SpreadBits = [](uint32_t v)
+	{
+		v &= 0xFFFF;
+		v = (v | (v << 8)) & 0x00FF00FF;
+		v = (v | (v << 4)) & 0x0F0F0F0F;
+		v = (v | (v << 2)) & 0x33333333;
+		v = (v | (v << 1)) & 0x55555555;
+		return v;
+	};
+	uint32_t px = (uint32_t)std::clamp(x, 0.0f, 65535.0f);
+	uint32_t py = (uint32_t)std::clamp(y, 0.0f, 65535.0f);
+	return SpreadBits(px) | (SpreadBits(py) << 1);
+}
+
+// One forward and one backward pass of adjacent swaps.
+// Quads that moved a little are put back in order right away. Quads that wrapped around the screen
+// may need a few frames to reach their place, so the array stays nearly sorted rather than fully sorted.
+// The Morton codes are computed once per call and swapped along with the quads.
+template <typename T>
+static void ResortMortonOrderStep(T* quads_CPU, uint32_t numQuads)
+{
+	if (numQuads < 2) return;
+
+	static std::vector<uint32_t> mortonCodes; // Reused between calls to avoid reallocating every frame
+	mortonCodes.resize(numQuads);
+	for (uint32_t i = 0; i < numQuads; i++)
+	{
+		mortonCodes[i] = GetMortonCode(quads_CPU[i].x, quads_CPU[i].y);
+	}
+
+	auto SwapIfOutOfOrder = [&](uint32_t i)
+	{
+		if (mortonCodes[i] < mortonCodes[i - 1])
+		{
+			std::swap(quads_CPU[i], quads_CPU[i - 1]);
+			std::swap(mortonCodes[i], mortonCodes[i - 1]);
+		}
+	};
+	for (uint32_t i = 1; i < numQuads; i++)
+	{
+		SwapIfOutOfOrder(i);
+	}
+	for (uint32_t i = numQuads - 1; i > 0; i--)
+	{
+		SwapIfOutOfOrder(i);
+	}
+}
+
+void SortQuadsMortonOrder(Quad* quads_CPU, uint32_t numQuads)
+{
+	std::sort(quads_CPU, quads_CPU + numQuads, [](const Quad& a, const Quad& b)
+	{
+		return GetMortonCode(a.x, a.y) < GetMortonCode(b.x, b.y);
+	});
+}
+
+void UpdateQuadsCPU(ig::Extent2D viewExtent, Quad* quads_CPU, uint32_t numQuads, bool keepMortonOrder)
+{
+	// Move quads to the right
+	for (uint32_t i = 0; i < numQuads; i++)
+	{
+		quads_CPU[i].x += 1.0f;
+		if (quads_CPU[i].x > viewExtent.width) quads_CPU[i].x -= (float)viewExtent.width;
+	}
+	if (keepMortonOrder) ResortMortonOrderStep(quads_CPU, numQuads);
+}
+void UpdateStructuredQuadsCPU(ig::Extent2D viewExtent, StructuredQuad* quads_CPU, uint32_t numQuads, bool keepMortonOrder)
 {
 	// Move quads to the right
 	for (uint32_t i = 0; i < numQuads; i++)
@@ -26,8 +147,79 @@ void UpdateQuadsCPU(ig::Extent2D viewExtent, Quad* quads_CPU, uint32_t numQuads)
 		quads_CPU[i].x += 1.0f;
 		if (quads_CPU[i].x > viewExtent.width) quads_CPU[i].x -= (float)viewExtent.width;
 	}
+	if (keepMortonOrder) ResortMortonOrderStep(quads_CPU, numQuads);
 }
-void UpdateStructuredQuadsCPU(ig::Extent2D viewExtent, StructuredQuad* quads_CPU, uint32_t numQuads)
+
+std::vector<TransformedQuad> GenerateTransformedQuads(const Quad* quads_CPU, uint32_t numQuads)
+{
+	ig::Xoshiro256pp random(3); // Local generator, so the global random state is left alone
+	std::vector<TransformedQuad> out(numQuads);
+	for (uint32_t i = 0; i < numQuads; i++)
+	{
+		const Quad& q = quads_CPU[i];
+		const float scale = random.NextFloat(0.5f, 1.5f);
+		out[i] = TransformedQuad{ q.x, q.y, q.width * scale, q.height * scale, random.NextFloat(0, (float)IGLO_PI * 2.0f), q.color };
+	}
+	return out;
+}
+
+void UpdateTransformedQuadsCPU(ig::Extent2D viewExtent, TransformedQuad* quads_CPU, uint32_t numQuads)
+{
+	// Move quads to the right and spin them
+	for (uint32_t i = 0; i < numQuads; i++)
+	{
+		quads_CPU[i].x += 1.0f;
+		if (quads_CPU[i].x > viewExtent.width) quads_CPU[i].x -= (float)viewExtent.width;
+		quads_CPU[i].rotation += transformedQuadRotationPerFrame;
+	}
+}
+
+std::unique_ptr<ig::Texture> CreateSpriteAtlas(const ig::IGLOContext& context, ig::CommandList& cmd, bool premultipliedAlpha)
+{
+	constexpr uint32_t cellSize = spriteAtlasSize / spriteAtlasCellsPerRow;
+	std::vector<ig::Color32> pixels(spriteAtlasSize * spriteAtlasSize);
+	for (uint32_t y = 0; y < spriteAtlasSize; y++)
+	{
+		for (uint32_t x = 0; x < spriteAtlasSize; x++)
+		{
+			// Each sprite is a disc with stripes. The stripe width depends on the sprite.
+			const uint32_t cellIndex = ((y / cellSize) * spriteAtlasCellsPerRow) + (x / cellSize);
+			const float dx = (float)(x % cellSize) + 0.5f - (float)cellSize * 0.5f;
+			const float dy = (float)(y % cellSize) + 0.5f - (float)cellSize * 0.5f;
+			const float distance = std::sqrt((dx * dx) + (dy * dy));
+			const float alpha = std::clamp((float)cellSize * 0.5f - distance, 0.0f, 1.0f);
+			const bool stripe = (((x + y) / (cellIndex + 2)) % 2) == 0;
+			const float brightness = (stripe ? 255.0f : 160.0f) * (premultipliedAlpha ? alpha : 1.0f);
+			pixels[(y * spriteAtlasSize) + x] = ig::Color32((uint8_t)brightness, (uint8_t)brightness, (uint8_t)brightness, (uint8_t)(alpha * 255.0f));
+		}
+	}
+
+	std::unique_ptr<ig::Texture> atlas = ig::Texture::Create(context, spriteAtlasSize, spriteAtlasSize,
+		ig::Format::BYTE_BYTE_BYTE_BYTE, ig::TextureUsage::Default);
+	cmd.AddTextureBarrier(*atlas, ig::SimpleBarrier::Discard, ig::SimpleBarrier::CopyDest);
+	cmd.FlushBarriers();
+	atlas->SetPixels(cmd, pixels.data());
+	cmd.AddTextureBarrier(*atlas, ig::SimpleBarrier::CopyDest, ig::SimpleBarrier::PixelShaderResource);
+	cmd.FlushBarriers();
+	return atlas;
+}
+
+std::vector<SpriteQuad> GenerateSpriteQuads(const Quad* quads_CPU, uint32_t numQuads)
+{
+	constexpr float cellUV = 1.0f / (float)spriteAtlasCellsPerRow;
+	std::vector<SpriteQuad> out(numQuads);
+	for (uint32_t i = 0; i < numQuads; i++)
+	{
+		const Quad& q = quads_CPU[i];
+		const uint32_t cellIndex = i % (spriteAtlasCellsPerRow * spriteAtlasCellsPerRow);
+		const float left = (float)(cellIndex % spriteAtlasCellsPerRow) * cellUV;
+		const float top = (float)(cellIndex / spriteAtlasCellsPerRow) * cellUV;
+		out[i] = SpriteQuad{ q.x, q.y, q.width, q.height, ig::FloatRect(left, top, left + cellUV, top + cellUV), q.color };
+	}
+	return out;
+}
+
+void UpdateSpriteQuadsCPU(ig::Extent2D viewExtent, SpriteQuad* quads_CPU, uint32_t numQuads)
 {
 	// Move quads to the right
 	for (uint32_t i = 0; i < numQuads; i++)
@@ -37,6 +229,155 @@ void UpdateStructuredQuadsCPU(ig::Extent2D viewExtent, StructuredQuad* quads_CPU
 	}
 }
 
+std::vector<ig::Vertex_Circle> GenerateCircles(const Quad* quads_CPU, uint32_t numQuads)
+{
+	std::vector<ig::Vertex_Circle> out(numQuads);
+	for (uint32_t i = 0; i < numQuads; i++)
+	{
+		const Quad& q = quads_CPU[i];
+		const float radius = q.width * 0.5f;
+		out[i] = ig::Vertex_Circle
+		{
+			.position = ig::Vector2(q.x + radius, q.y + radius),
+			.radius = radius,
+			.smoothing = std::min(1.0f, radius), // Zero sized quads give zero sized circles
+			.borderThickness = 0.0f,
+			.innerColor = q.color,
+			.outerColor = ig::Color32(q.color.red / 2, q.color.green / 2, q.color.blue / 2, q.color.alpha),
+			.borderColor = ig::Colors::Transparent,
+		};
+	}
+	return out;
+}
+
+void UpdateCirclesCPU(ig::Extent2D viewExtent, ig::Vertex_Circle* circles_CPU, uint32_t numCircles)
+{
+	// Move circles to the right
+	for (uint32_t i = 0; i < numCircles; i++)
+	{
+		circles_CPU[i].position.x += 1.0f;
+		if (circles_CPU[i].position.x > viewExtent.width) circles_CPU[i].position.x -= (float)viewExtent.width;
+	}
+}
+
+std::string FindTextFontFile()
+{
+	const char* candidates[] =
+	{
+		"C:/Windows/Fonts/arial.ttf",
+		"C:/Windows/Fonts/segoeui.ttf",
+		"/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+		"/usr/share/fonts/TTF/DejaVuSans.ttf",
+		"/usr/share/fonts/dejavu/DejaVuSans.ttf",
+		"/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+	};
+	for (const char* filename : candidates)
+	{
+		if (ig::FileExists(filename)) return filename;
+	}
+	return "";
+}
+
+std::vector<std::string> GenerateTextStrings(uint32_t numStrings, uint32_t charactersPerString)
+{
+	ig::Xoshiro256pp random(4); // Local generator, so the global random state is left alone
+	std::vector<std::string> out(numStrings);
+	for (std::string& str : out)
+	{
+		// Words of 1 to 10 letters or digits, separated by spaces
+		str.reserve(charactersPerString);
+		while (str.size() < charactersPerString)
+		{
+			const uint32_t wordLength = 1 + (random.NextUInt32() % 10);
+			const bool number = (random.NextUInt32() % 5) == 0;
+			for (uint32_t i = 0; i < wordLength && str.size() < charactersPerString; i++)
+			{
+				if (number) str.push_back((char)('0' + (random.NextUInt32() % 10)));
+				else if (i == 0) str.push_back((char)('A' + (random.NextUInt32() % 26)));
+				else str.push_back((char)('a' + (random.NextUInt32() % 26)));
+			}
+			if (str.size() < charactersPerString) str.push_back(' ');
+		}
+	}
+	return out;
+}
+
+void UpdateTextStringsCPU(std::vector<std::string>& strings)
+{
+	for (std::string& str : strings)
+	{
+		for (char& c : str)
+		{
+			if (c >= 'a' && c <= 'z') c = (c == 'z') ? 'a' : c + 1;
+			else if (c >= 'A' && c <= 'Z') c = (c == 'Z') ? 'A' : c + 1;
+			else if (c >= '0' && c <= '9') c = (c == '9') ? '0' : c + 1;
+		}
+	}
+}
+
+std::vector<Billboard> GenerateBillboards(const Quad* quads_CPU, uint32_t numQuads, ig::Extent2D viewExtent)
+{
+	ig::Xoshiro256pp random(2); // Local generator, so the global random state is left alone
+	std::vector<Billboard> out(numQuads);
+	for (uint32_t i = 0; i < numQuads; i++)
+	{
+		const Quad& q = quads_CPU[i];
+		Billboard& b = out[i];
+		b.position.x = ((q.x / (float)viewExtent.width) * 2.0f - 1.0f) * billboardFieldHalfExtent;
+		b.position.y = random.NextFloat(0, billboardMaxHeight);
+		b.position.z = ((q.y / (float)viewExtent.height) * 2.0f - 1.0f) * billboardFieldHalfExtent;
+		b.size = q.width * billboardWorldUnitsPerPixel;
+		b.color = q.color;
+	}
+	return out;
+}
+
+BillboardCameraConstants GetBillboardCameraConstants(ig::BaseCamera& camera)
+{
+	const ig::Matrix4x4 m = camera.GetViewProjMatrix();
+	const ig::Vector3 right = -camera.GetLeft();
+	const ig::Vector3 up = camera.GetUp();
+
+	BillboardCameraConstants out;
+	out.viewProj = m.GetTransposed();
+	out.cameraRight = ig::Vector4(right.x, right.y, right.z, 0);
+	out.cameraUp = ig::Vector4(up.x, up.y, up.z, 0);
+
+	// Positions are transformed as row vectors, so the frustum planes are made from the columns of the matrix
+	const ig::Vector4 column1(m.a1, m.b1, m.c1, m.d1);
+	const ig::Vector4 column2(m.a2, m.b2, m.c2, m.d2);
+	const ig::Vector4 column3(m.a3, m.b3, m.c3, m.d3);
+	const ig::Vector4 column4(m.a4, m.b4, m.c4, m.d4);
+	const ig::Vector4 planes[6] =
+	{
+		column4 + column1, // Left
+		column4 - column1, // Right
+		column4 + column2, // Bottom
+		column4 - column2, // Top
+		column3, // Near
+		column4 - column3, // Far
+	};
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		const float length = ig::Vector3(planes[i].x, planes[i].y, planes[i].z).GetMagnitude();
+		out.frustumPlanes[i] = planes[i] / length;
+	}
+	return out;
+}
+
+bool IsBillboardInFrustum(const Billboard& billboard, const BillboardCameraConstants& constants)
+{
+	// Bounding sphere test, same as VS_BillboardRect.hlsl
+	const float radius = billboard.size * 0.70710678f;
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		const ig::Vector4& p = constants.frustumPlanes[i];
+		const float distance = (p.x * billboard.position.x) + (p.y * billboard.position.y) + (p.z * billboard.position.z) + p.w;
+		if (distance < -radius) return false;
+	}
+	return true;
+}
+
 Benchmark_1DrawCall::Benchmark_1DrawCall(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
 {
@@ -50,12 +391,12 @@ Benchmark_1DrawCall::Benchmark_1DrawCall(const ig::IGLOContext& context, ig::Com
 	{
 		.VS = SHADER_VS(g_VS_Triangles),
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -85,6 +426,38 @@ void Benchmark_1DrawCall::OnRender(ig::CommandList& cmd)
 	}
 }
 
+Benchmark_PushConstantDrawCall::Benchmark_PushConstantDrawCall(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_PushConstantRect), // No vertex layout, the quad comes from push constants
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_PushConstantDrawCall::OnRender(ig::CommandList& cmd)
+{
+	QuadPushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants.screenSize, sizeof(pushConstants.screenSize), offsetof(QuadPushConstants, screenSize));
+
+	for (uint32_t i = 0; i < params.numQuads; i++)
+	{
+		// Only the 20 bytes of the quad are pushed per draw call
+		cmd.SetPushConstants(&params.quads[i], sizeof(Quad), offsetof(QuadPushConstants, quad));
+		cmd.Draw(6);
+	}
+}
+
 Benchmark_BatchedTriangleList::Benchmark_BatchedTriangleList(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
 {
@@ -101,12 +474,12 @@ Benchmark_BatchedTriangleList::Benchmark_BatchedTriangleList(const ig::IGLOConte
 	{
 		.VS = SHADER_VS(g_VS_Triangles),
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -155,12 +528,12 @@ Benchmark_DynamicIndexBuffer::Benchmark_DynamicIndexBuffer(const ig::IGLOContext
 	{
 		.VS = SHADER_VS(g_VS_Triangles),
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -235,12 +608,12 @@ Benchmark_StaticIndexBuffer::Benchmark_StaticIndexBuffer(const ig::IGLOContext&
 	{
 		.VS = SHADER_VS(g_VS_Triangles),
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -278,12 +651,12 @@ Benchmark_RawVertexPulling::Benchmark_RawVertexPulling(const ig::IGLOContext& co
 	{
 		.VS = SHADER_VS(g_VS_RawRect), // Raw vertex pulling shader
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = {}, // No vertex layout
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -301,6 +674,40 @@ void Benchmark_RawVertexPulling::OnRender(ig::CommandList& cmd)
 	cmd.Draw(params.numQuads * 6);
 }
 
+#ifdef IGLO_VULKAN
+Benchmark_AddressVertexPulling::Benchmark_AddressVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Quad) * params.numQuads, ig::BufferUsage::Dynamic);
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_AddressRect), // Buffer device address vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_AddressVertexPulling::OnRender(ig::CommandList& cmd)
+{
+	rawBuffer->SetDynamicData((void*)params.quads);
+
+	AddressPushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.bufferAddress = rawBuffer->GetGPUAddress();
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+#endif
+
 Benchmark_StructuredVertexPulling::Benchmark_StructuredVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
 {
@@ -310,12 +717,12 @@ Benchmark_StructuredVertexPulling::Benchmark_StructuredVertexPulling(const ig::I
 	{
 		.VS = SHADER_VS(g_VS_StructuredRect), // Structured vertex pulling shader
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = {}, // No vertex layout
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -333,6 +740,92 @@ void Benchmark_StructuredVertexPulling::OnRender(ig::CommandList& cmd)
 	cmd.Draw(params.numQuads * 6);
 }
 
+Benchmark_TypedVertexPulling::Benchmark_TypedVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	// One 32-bit element per quad member
+	typedBuffer = ig::Buffer::CreateTypedBuffer(context, ig::Format::UINT32_NotNormalized, params.numQuads * 5, ig::BufferUsage::Dynamic);
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_TypedRect), // Typed vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_TypedVertexPulling::OnRender(ig::CommandList& cmd)
+{
+	typedBuffer->SetDynamicData((void*)params.quads);
+
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.rawOrStructuredBufferIndex = typedBuffer->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
+Benchmark_TextureVertexPulling::Benchmark_TextureVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	const uint32_t numRows = (params.numQuads + textureQuadsPerRow - 1) / textureQuadsPerRow;
+	texels.resize(numRows * textureQuadsPerRow);
+	memcpy(texels.data(), params.quads, sizeof(Quad) * params.numQuads);
+
+	texture = ig::Texture::Create(context, textureQuadsPerRow * 5, numRows, ig::Format::UINT32_NotNormalized, ig::TextureUsage::Default);
+	cmd.AddTextureBarrier(*texture, ig::SimpleBarrier::Discard, ig::SimpleBarrier::CopyDest);
+	cmd.FlushBarriers();
+	texture->SetPixels(cmd, texels.data());
+	cmd.AddTextureBarrier(*texture, ig::SimpleBarrier::CopyDest, ig::SimpleBarrier::VertexShaderResource);
+	cmd.FlushBarriers();
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_TextureRect), // Texture vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_TextureVertexPulling::OnRender(ig::CommandList& cmd)
+{
+	// Textures can't be mapped, so the quads are uploaded and copied to the texture each frame
+	memcpy(texels.data(), params.quads, sizeof(Quad) * params.numQuads);
+
+	// Copies can't be recorded inside a render pass
+	cmd.SafePauseRenderPass();
+	{
+		cmd.AddTextureBarrier(*texture, ig::SimpleBarrier::VertexShaderResource, ig::SimpleBarrier::CopyDest);
+		cmd.FlushBarriers();
+		texture->SetPixels(cmd, texels.data());
+		cmd.AddTextureBarrier(*texture, ig::SimpleBarrier::CopyDest, ig::SimpleBarrier::VertexShaderResource);
+		cmd.FlushBarriers();
+	}
+	cmd.SafeResumeRenderPass();
+
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.rawOrStructuredBufferIndex = texture->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
 Benchmark_Instancing::Benchmark_Instancing(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
 {
@@ -351,12 +844,12 @@ Benchmark_Instancing::Benchmark_Instancing(const ig::IGLOContext& context, ig::C
 	{
 		.VS = SHADER_VS(g_VS_InstancedRect), // Instancing shader
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleStrip, // Use triangle strips
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -374,25 +867,57 @@ void Benchmark_Instancing::OnRender(ig::CommandList& cmd)
 	cmd.DrawInstanced(4, params.numQuads);
 }
 
-Benchmark_GPUTriangles::Benchmark_GPUTriangles(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+Benchmark_ConstantBufferInstancing::Benchmark_ConstantBufferInstancing(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
 {
-	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Vertex), params.numQuads * 6, ig::BufferUsage::Default);
+	paddedChunk = std::vector<uint8_t>(constantChunkByteSize, 0);
 
-	std::vector<Vertex> vertexData(params.numQuads * 6);
-	uint32_t currentVertex = 0;
-	for (uint32_t i = 0; i < params.numQuads; i++)
+	ig::PipelineDesc desc =
 	{
-		const Quad& q = params.quads[i];
-		vertexData[currentVertex] = { q.x, q.y, q.color };
-		vertexData[currentVertex + 1] = { q.x + q.width, q.y, q.color };
-		vertexData[currentVertex + 2] = { q.x, q.y + q.height, q.color };
-		vertexData[currentVertex + 3] = { q.x, q.y + q.height, q.color };
-		vertexData[currentVertex + 4] = { q.x + q.width, q.y, q.color };
-		vertexData[currentVertex + 5] = { q.x + q.width, q.y + q.height, q.color };
-		currentVertex += 6;
+		.VS = SHADER_VS(g_VS_ConstantBufferRect), // Constant buffer instancing shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleStrip, // Use triangle strips
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_ConstantBufferInstancing::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+
+	// One temporary constant buffer and one draw call per chunk
+	for (uint32_t firstQuad = 0; firstQuad < params.numQuads; firstQuad += quadsPerConstantChunk)
+	{
+		uint32_t numQuadsInChunk = std::min(quadsPerConstantChunk, params.numQuads - firstQuad);
+		const void* chunkData = &params.quads[firstQuad];
+		if ((uint64_t)(params.numQuads - firstQuad) * sizeof(Quad) < constantChunkByteSize)
+		{
+			memcpy(paddedChunk.data(), chunkData, numQuadsInChunk * sizeof(Quad));
+			chunkData = paddedChunk.data();
+		}
+		ig::Descriptor chunk = context.CreateTempConstant(chunkData, constantChunkByteSize);
+
+		pushConstants.rawOrStructuredBufferIndex = chunk.heapIndex;
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.DrawInstanced(4, numQuadsInChunk);
 	}
-	vertexBuffer->SetData(cmd, vertexData.data());
+}
+
+Benchmark_ComputeExpansion::Benchmark_ComputeExpansion(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Quad) * params.numQuads, ig::BufferUsage::Dynamic);
+	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Vertex), params.numQuads * 6, ig::BufferUsage::UnorderedAccess);
+
+	computePipeline = ig::Pipeline::CreateCompute(context, SHADER_CS(g_CS_ExpandQuads));
 
 	const std::vector<ig::VertexElement> vertexLayout =
 	{
@@ -404,18 +929,45 @@ Benchmark_GPUTriangles::Benchmark_GPUTriangles(const ig::IGLOContext& context, i
 	{
 		.VS = SHADER_VS(g_VS_Triangles),
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
 
-void Benchmark_GPUTriangles::OnRender(ig::CommandList& cmd)
+void Benchmark_ComputeExpansion::OnRender(ig::CommandList& cmd)
 {
+	rawBuffer->SetDynamicData((void*)params.quads);
+
+	ExpandPushConstants expandPushConstants;
+	expandPushConstants.srcQuadBufferIndex = rawBuffer->GetDescriptor().heapIndex;
+	expandPushConstants.destVertexBufferIndex = vertexBuffer->GetUnorderedAccessDescriptor().heapIndex;
+	expandPushConstants.numQuads = params.numQuads;
+
+	// Compute work can't be recorded inside a render pass
+	cmd.SafePauseRenderPass();
+	{
+		// The previous frame's draw must finish reading the vertices before they are overwritten
+		cmd.AddBufferBarrier(*vertexBuffer,
+			ig::BarrierSync::All, ig::BarrierAccess::VertexBuffer,
+			ig::BarrierSync::ComputeShading, ig::BarrierAccess::UnorderedAccess);
+		cmd.FlushBarriers();
+
+		cmd.SetPipeline(*computePipeline);
+		cmd.SetComputePushConstants(&expandPushConstants, sizeof(expandPushConstants));
+		cmd.DispatchCompute((params.numQuads + 63) / 64, 1, 1);
+
+		cmd.AddBufferBarrier(*vertexBuffer,
+			ig::BarrierSync::ComputeShading, ig::BarrierAccess::UnorderedAccess,
+			ig::BarrierSync::All, ig::BarrierAccess::VertexBuffer);
+		cmd.FlushBarriers();
+	}
+	cmd.SafeResumeRenderPass();
+
 	PushConstants pushConstants;
 	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
 
@@ -425,18 +977,263 @@ void Benchmark_GPUTriangles::OnRender(ig::CommandList& cmd)
 	cmd.Draw(vertexBuffer->GetNumElements());
 }
 
-Benchmark_GPUIndexBuffer::Benchmark_GPUIndexBuffer(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+Benchmark_RawVertexPullingCopy::Benchmark_RawVertexPullingCopy(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
 {
-	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Vertex), params.numQuads * 6, ig::BufferUsage::Default);
-	indexBuffer = ig::Buffer::CreateIndexBuffer(context, ig::IndexFormat::UINT32, params.numQuads * 6, ig::BufferUsage::Default);
+	rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Quad) * params.numQuads, ig::BufferUsage::Default);
+	stagingBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Quad) * params.numQuads, ig::BufferUsage::Dynamic);
 
-	std::vector<Vertex> vertexData(params.numQuads * 6);
-	uint32_t currentVertex = 0;
-	for (uint32_t i = 0; i < params.numQuads; i++)
+	ig::PipelineDesc desc =
 	{
-		const Quad& q = params.quads[i];
-		vertexData[currentVertex] = { q.x, q.y, q.color };
+		.VS = SHADER_VS(g_VS_RawRect), // Raw vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_RawVertexPullingCopy::OnRender(ig::CommandList& cmd)
+{
+	// Copies can't be recorded inside a render pass
+	cmd.SafePauseRenderPass();
+	{
+		cmd.AddBufferBarrier(*rawBuffer, ig::SimpleBarrier::VertexShaderResource, ig::SimpleBarrier::CopyDest);
+		cmd.FlushBarriers();
+
+		// Writes the quads to this frame's staging buffer and copies them to the device-local buffer
+		stagingBuffer->SetDynamicData(params.quads);
+		cmd.CopyBuffer(*stagingBuffer, *rawBuffer);
+
+		cmd.AddBufferBarrier(*rawBuffer, ig::SimpleBarrier::CopyDest, ig::SimpleBarrier::VertexShaderResource);
+		cmd.FlushBarriers();
+	}
+	cmd.SafeResumeRenderPass();
+
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.rawOrStructuredBufferIndex = rawBuffer->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
+Benchmark_InstancingCopy::Benchmark_InstancingCopy(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Quad), params.numQuads, ig::BufferUsage::Default);
+	stagingBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Quad), params.numQuads, ig::BufferUsage::Dynamic);
+
+	// Use a per-instance vertex layout
+	const std::vector<ig::VertexElement> vertexLayout =
+	{
+		ig::VertexElement(ig::Format::FLOAT_FLOAT, "POSITION", 0, 0, ig::InputClass::PerInstance, 1),
+		ig::VertexElement(ig::Format::FLOAT, "WIDTH", 0, 0, ig::InputClass::PerInstance, 1),
+		ig::VertexElement(ig::Format::FLOAT, "HEIGHT", 0, 0,ig::InputClass::PerInstance, 1),
+		ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "COLOR", 0, 0, ig::InputClass::PerInstance, 1),
+	};
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_InstancedRect), // Instancing shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = vertexLayout,
+		.primitiveTopology = ig::PrimitiveTopology::TriangleStrip, // Use triangle strips
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_InstancingCopy::OnRender(ig::CommandList& cmd)
+{
+	// Copies can't be recorded inside a render pass
+	cmd.SafePauseRenderPass();
+	{
+		cmd.AddBufferBarrier(*vertexBuffer,
+			ig::BarrierSync::All, ig::BarrierAccess::VertexBuffer,
+			ig::BarrierSync::Copy, ig::BarrierAccess::CopyDest);
+		cmd.FlushBarriers();
+
+		// Writes the quads to this frame's staging buffer and copies them to the device-local buffer
+		stagingBuffer->SetDynamicData(params.quads);
+		cmd.CopyBuffer(*stagingBuffer, *vertexBuffer);
+
+		cmd.AddBufferBarrier(*vertexBuffer,
+			ig::BarrierSync::Copy, ig::BarrierAccess::CopyDest,
+			ig::BarrierSync::All, ig::BarrierAccess::VertexBuffer);
+		cmd.FlushBarriers();
+	}
+	cmd.SafeResumeRenderPass();
+
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.SetVertexBuffer(*vertexBuffer);
+	cmd.DrawInstanced(4, params.numQuads);
+}
+
+Benchmark_ChunkedVertexPulling::Benchmark_ChunkedVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd,
+	const BenchmarkParams& params, uint32_t numChunks)
+	: Benchmark(context, cmd, params), numChunks(numChunks)
+{
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_RawRect), // Raw vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_ChunkedVertexPulling::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+
+	// Each chunk is written to its own temp buffer and drawn with its own draw call.
+	// All chunks are recorded into the same command list, so the GPU doesn't read any of them before the frame is submitted.
+	// This measures many smaller temp allocations and draws against the single upload of Raw Vertex Pulling.
+	// numChunks must be large enough that a chunk fits in the upload heap's linear page, or a large page is created every frame.
+	const uint32_t quadsPerChunk = (params.numQuads + numChunks - 1) / numChunks;
+	for (uint32_t firstQuad = 0; firstQuad < params.numQuads; firstQuad += quadsPerChunk)
+	{
+		uint32_t numQuadsInChunk = std::min(quadsPerChunk, params.numQuads - firstQuad);
+		ig::Descriptor chunk = context.CreateTempRawBuffer(&params.quads[firstQuad], numQuadsInChunk * sizeof(Quad));
+
+		pushConstants.rawOrStructuredBufferIndex = chunk.heapIndex;
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.Draw(numQuadsInChunk * 6);
+	}
+}
+
+Benchmark_DrawGranularity::Benchmark_DrawGranularity(const ig::IGLOContext& context, ig::CommandList& cmd,
+	const BenchmarkParams& params, uint32_t quadsPerDraw)
+	: Benchmark(context, cmd, params), quadsPerDraw(quadsPerDraw)
+{
+	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Quad), params.numQuads, ig::BufferUsage::Dynamic);
+
+	// Use a per-instance vertex layout
+	const std::vector<ig::VertexElement> vertexLayout =
+	{
+		ig::VertexElement(ig::Format::FLOAT_FLOAT, "POSITION", 0, 0, ig::InputClass::PerInstance, 1),
+		ig::VertexElement(ig::Format::FLOAT, "WIDTH", 0, 0, ig::InputClass::PerInstance, 1),
+		ig::VertexElement(ig::Format::FLOAT, "HEIGHT", 0, 0,ig::InputClass::PerInstance, 1),
+		ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "COLOR", 0, 0, ig::InputClass::PerInstance, 1),
+	};
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_InstancedRect), // Instancing shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = vertexLayout,
+		.primitiveTopology = ig::PrimitiveTopology::TriangleStrip, // Use triangle strips
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_DrawGranularity::OnRender(ig::CommandList& cmd)
+{
+	vertexBuffer->SetDynamicData((void*)params.quads);
+
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.SetVertexBuffer(*vertexBuffer);
+
+	// Each draw call renders a sub-range of the same vertex buffer
+	for (uint32_t firstQuad = 0; firstQuad < params.numQuads; firstQuad += quadsPerDraw)
+	{
+		uint32_t numQuadsInDraw = std::min(quadsPerDraw, params.numQuads - firstQuad);
+		cmd.DrawInstanced(4, numQuadsInDraw, 0, firstQuad);
+	}
+}
+
+Benchmark_GPUTriangles::Benchmark_GPUTriangles(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Vertex), params.numQuads * 6, ig::BufferUsage::Default);
+
+	std::vector<Vertex> vertexData(params.numQuads * 6);
+	uint32_t currentVertex = 0;
+	for (uint32_t i = 0; i < params.numQuads; i++)
+	{
+		const Quad& q = params.quads[i];
+		vertexData[currentVertex] = { q.x, q.y, q.color };
+		vertexData[currentVertex + 1] = { q.x + q.width, q.y, q.color };
+		vertexData[currentVertex + 2] = { q.x, q.y + q.height, q.color };
+		vertexData[currentVertex + 3] = { q.x, q.y + q.height, q.color };
+		vertexData[currentVertex + 4] = { q.x + q.width, q.y, q.color };
+		vertexData[currentVertex + 5] = { q.x + q.width, q.y + q.height, q.color };
+		currentVertex += 6;
+	}
+	vertexBuffer->SetData(cmd, vertexData.data());
+
+	const std::vector<ig::VertexElement> vertexLayout =
+	{
+		ig::VertexElement(ig::Format::FLOAT_FLOAT, "POSITION"),
+		ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "COLOR"),
+	};
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_Triangles),
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = vertexLayout,
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_GPUTriangles::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.SetVertexBuffer(*vertexBuffer);
+	cmd.Draw(vertexBuffer->GetNumElements());
+}
+
+Benchmark_GPUIndexBuffer::Benchmark_GPUIndexBuffer(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Vertex), params.numQuads * 6, ig::BufferUsage::Default);
+	indexBuffer = ig::Buffer::CreateIndexBuffer(context, ig::IndexFormat::UINT32, params.numQuads * 6, ig::BufferUsage::Default);
+
+	std::vector<Vertex> vertexData(params.numQuads * 6);
+	uint32_t currentVertex = 0;
+	for (uint32_t i = 0; i < params.numQuads; i++)
+	{
+		const Quad& q = params.quads[i];
+		vertexData[currentVertex] = { q.x, q.y, q.color };
 		vertexData[currentVertex + 1] = { q.x + q.width, q.y, q.color };
 		vertexData[currentVertex + 2] = { q.x, q.y + q.height, q.color };
 		vertexData[currentVertex + 3] = { q.x, q.y + q.height, q.color };
@@ -471,12 +1268,12 @@ Benchmark_GPUIndexBuffer::Benchmark_GPUIndexBuffer(const ig::IGLOContext& contex
 	{
 		.VS = SHADER_VS(g_VS_Triangles),
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -493,22 +1290,23 @@ void Benchmark_GPUIndexBuffer::OnRender(ig::CommandList& cmd)
 	cmd.Draw(vertexBuffer->GetNumElements());
 }
 
-Benchmark_GPURaw::Benchmark_GPURaw(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
-	: Benchmark(context, cmd, params)
+Benchmark_GPURaw::Benchmark_GPURaw(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+	bool halfPrecision)
+	: Benchmark(context, cmd, params), halfPrecision(halfPrecision)
 {
 	rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Quad) * params.numQuads, ig::BufferUsage::Default);
 	rawBuffer->SetData(cmd, (void*)params.quads);
 
 	ig::PipelineDesc desc =
 	{
-		.VS = SHADER_VS(g_VS_RawRect), // Raw vertex pulling shader
+		.VS = halfPrecision ? SHADER_VS(g_VS_RawRectHalf) : SHADER_VS(g_VS_RawRect), // Raw vertex pulling shader
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = {}, // No vertex layout
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -524,6 +1322,130 @@ void Benchmark_GPURaw::OnRender(ig::CommandList& cmd)
 	cmd.Draw(params.numQuads * 6);
 }
 
+Benchmark_GPUWaveRaw::Benchmark_GPUWaveRaw(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Quad) * params.numQuads, ig::BufferUsage::Default);
+	rawBuffer->SetData(cmd, (void*)params.quads);
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_RawRectWave), // Raw vertex pulling shader with wave shared loads
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_GPUWaveRaw::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.rawOrStructuredBufferIndex = rawBuffer->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
+template <typename Record>
+Benchmark_GPURecordLayout<Record>::Benchmark_GPURecordLayout(const ig::IGLOContext& context, ig::CommandList& cmd,
+	const BenchmarkParams& params, bool structured)
+	: Benchmark(context, cmd, params), structured(structured)
+{
+	std::vector<Record> records(params.numQuads);
+	for (uint32_t i = 0; i < params.numQuads; i++)
+	{
+		records[i] = Record::FromQuad(params.quads[i]);
+	}
+
+	if (structured)
+	{
+		buffer = ig::Buffer::CreateStructuredBuffer(context, sizeof(Record), params.numQuads, ig::BufferUsage::Default);
+	}
+	else
+	{
+		buffer = ig::Buffer::CreateRawBuffer(context, sizeof(Record) * params.numQuads, ig::BufferUsage::Default);
+	}
+	buffer->SetData(cmd, records.data());
+
+	ig::Shader vertexShader;
+	if constexpr (sizeof(Record) == 16)
+	{
+		vertexShader = structured ? SHADER_VS(g_VS_StructuredRect16) : SHADER_VS(g_VS_RawRect16);
+	}
+	else
+	{
+		vertexShader = structured ? SHADER_VS(g_VS_StructuredRect32) : SHADER_VS(g_VS_RawRect32);
+	}
+
+	ig::PipelineDesc desc =
+	{
+		.VS = vertexShader,
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+template <typename Record>
+void Benchmark_GPURecordLayout<Record>::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.rawOrStructuredBufferIndex = buffer->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
+template class Benchmark_GPURecordLayout<PackedQuad16>;
+template class Benchmark_GPURecordLayout<AlignedQuad32>;
+
+#ifdef IGLO_VULKAN
+Benchmark_GPUAddress::Benchmark_GPUAddress(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Quad) * params.numQuads, ig::BufferUsage::Default);
+	rawBuffer->SetData(cmd, (void*)params.quads);
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_AddressRect), // Buffer device address vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_GPUAddress::OnRender(ig::CommandList& cmd)
+{
+	AddressPushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.bufferAddress = rawBuffer->GetGPUAddress();
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+#endif
+
 Benchmark_GPUStructured::Benchmark_GPUStructured(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
 {
@@ -534,12 +1456,12 @@ Benchmark_GPUStructured::Benchmark_GPUStructured(const ig::IGLOContext& context,
 	{
 		.VS = SHADER_VS(g_VS_StructuredRect), // Structured vertex pulling shader
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = {}, // No vertex layout
 		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -555,8 +1477,79 @@ void Benchmark_GPUStructured::OnRender(ig::CommandList& cmd)
 	cmd.Draw(params.numQuads * 6);
 }
 
-Benchmark_GPUInstancing::Benchmark_GPUInstancing(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+Benchmark_GPUTyped::Benchmark_GPUTyped(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	typedBuffer = ig::Buffer::CreateTypedBuffer(context, ig::Format::UINT32_NotNormalized, params.numQuads * 5, ig::BufferUsage::Default);
+	typedBuffer->SetData(cmd, (void*)params.quads);
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_TypedRect), // Typed vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_GPUTyped::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.rawOrStructuredBufferIndex = typedBuffer->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
+Benchmark_GPUTexture::Benchmark_GPUTexture(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
 	: Benchmark(context, cmd, params)
+{
+	const uint32_t numRows = (params.numQuads + textureQuadsPerRow - 1) / textureQuadsPerRow;
+	std::vector<Quad> texels(numRows * textureQuadsPerRow);
+	memcpy(texels.data(), params.quads, sizeof(Quad) * params.numQuads);
+
+	texture = ig::Texture::Create(context, textureQuadsPerRow * 5, numRows, ig::Format::UINT32_NotNormalized, ig::TextureUsage::Default);
+	cmd.AddTextureBarrier(*texture, ig::SimpleBarrier::Discard, ig::SimpleBarrier::CopyDest);
+	cmd.FlushBarriers();
+	texture->SetPixels(cmd, texels.data());
+	cmd.AddTextureBarrier(*texture, ig::SimpleBarrier::CopyDest, ig::SimpleBarrier::VertexShaderResource);
+	cmd.FlushBarriers();
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_TextureRect), // Texture vertex pulling shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_GPUTexture::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.rawOrStructuredBufferIndex = texture->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
+Benchmark_GPUInstancing::Benchmark_GPUInstancing(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+	bool halfPrecision)
+	: Benchmark(context, cmd, params), halfPrecision(halfPrecision)
 {
 	vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Quad), params.numQuads, ig::BufferUsage::Default);
 	vertexBuffer->SetData(cmd, (void*)params.quads);
@@ -572,14 +1565,14 @@ Benchmark_GPUInstancing::Benchmark_GPUInstancing(const ig::IGLOContext& context,
 
 	ig::PipelineDesc desc =
 	{
-		.VS = SHADER_VS(g_VS_InstancedRect), // Instancing shader
+		.VS = halfPrecision ? SHADER_VS(g_VS_InstancedRectHalf) : SHADER_VS(g_VS_InstancedRect), // Instancing shader
 		.PS = SHADER_PS(g_PS_Color),
-		.blendStates = { ig::BlendDesc::BlendDisabled },
-		.rasterizerState = ig::RasterizerDesc::NoCull,
-		.depthState = ig::DepthDesc::DepthDisabled,
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
 		.vertexLayout = vertexLayout,
 		.primitiveTopology = ig::PrimitiveTopology::TriangleStrip, // Use triangle strips
-		.renderTargetDesc = context.GetBackBufferRenderTargetDesc(),
+		.renderTargetDesc = params.renderTargetDesc,
 	};
 	pipeline = ig::Pipeline::CreateGraphics(context, desc);
 }
@@ -594,3 +1587,563 @@ void Benchmark_GPUInstancing::OnRender(ig::CommandList& cmd)
 	cmd.SetVertexBuffer(*vertexBuffer);
 	cmd.DrawInstanced(4, params.numQuads);
 }
+
+Benchmark_GPUConstantBuffer::Benchmark_GPUConstantBuffer(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	for (uint32_t firstQuad = 0; firstQuad < params.numQuads; firstQuad += quadsPerConstantChunk)
+	{
+		uint32_t numQuadsInChunk = std::min(quadsPerConstantChunk, params.numQuads - firstQuad);
+		std::vector<uint8_t> paddedChunk(constantChunkByteSize, 0);
+		memcpy(paddedChunk.data(), &params.quads[firstQuad], numQuadsInChunk * sizeof(Quad));
+
+		std::unique_ptr<ig::Buffer> chunk = ig::Buffer::CreateShaderConstant(context, constantChunkByteSize, ig::BufferUsage::Default);
+		chunk->SetData(cmd, paddedChunk.data());
+		constantBuffers.push_back(std::move(chunk));
+		numQuadsPerChunk.push_back(numQuadsInChunk);
+	}
+
+	ig::PipelineDesc desc =
+	{
+		.VS = SHADER_VS(g_VS_ConstantBufferRect), // Constant buffer instancing shader
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleStrip, // Use triangle strips
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_GPUConstantBuffer::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+
+	for (size_t i = 0; i < constantBuffers.size(); i++)
+	{
+		const ig::Buffer& chunk = *constantBuffers[i];
+
+		pushConstants.rawOrStructuredBufferIndex = chunk.GetDescriptor().heapIndex;
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.DrawInstanced(4, numQuadsPerChunk[i]);
+	}
+}
+
+Benchmark_GPUProcedural::Benchmark_GPUProcedural(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params)
+	: Benchmark(context, cmd, params)
+{
+	ig::PipelineDesc desc =
+	{
+		// Generates quads from the vertex ID
+		.VS = params.premultipliedAlpha ? SHADER_VS(g_VS_ProceduralRectPremultiplied) : SHADER_VS(g_VS_ProceduralRect),
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_GPUProcedural::OnRender(ig::CommandList& cmd)
+{
+	ProceduralPushConstants pushConstants;
+	pushConstants.seed = 1;
+	pushConstants.quadSize = params.quadSize;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(params.numQuads * 6);
+}
+
+Benchmark_Sprites::Benchmark_Sprites(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+	SpriteMethod method)
+	: Benchmark(context, cmd, params), method(method)
+{
+	spriteQuads = GenerateSpriteQuads(params.quads, params.numQuads);
+	atlas = CreateSpriteAtlas(context, cmd, params.premultipliedAlpha);
+	sampler = ig::Sampler::Create(context, ig::SamplerDesc::SmoothClampSampler);
+
+	ig::PipelineDesc desc =
+	{
+		.PS = SHADER_PS(g_PS_Sprite),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+
+	switch (method)
+	{
+	case SpriteMethod::RawVertexPulling:
+		buffer = ig::Buffer::CreateRawBuffer(context, sizeof(SpriteQuad) * params.numQuads, ig::BufferUsage::Dynamic);
+		desc.VS = SHADER_VS(g_VS_SpriteRaw);
+		desc.vertexLayout = {}; // No vertex layout
+		desc.primitiveTopology = ig::PrimitiveTopology::TriangleList;
+		break;
+
+	case SpriteMethod::Instancing:
+		buffer = ig::Buffer::CreateVertexBuffer(context, sizeof(SpriteQuad), params.numQuads, ig::BufferUsage::Dynamic);
+		desc.VS = SHADER_VS(g_VS_SpriteInstanced);
+		desc.vertexLayout =
+		{
+			ig::VertexElement(ig::Format::FLOAT_FLOAT, "POSITION", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::FLOAT, "WIDTH", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::FLOAT, "HEIGHT", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::FLOAT_FLOAT_FLOAT_FLOAT, "UVRECT", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "COLOR", 0, 0, ig::InputClass::PerInstance, 1),
+		};
+		desc.primitiveTopology = ig::PrimitiveTopology::TriangleStrip; // Use triangle strips
+		break;
+
+	default:
+		vertices = std::vector<SpriteVertex>(params.numQuads * 6);
+		buffer = ig::Buffer::CreateVertexBuffer(context, sizeof(SpriteVertex), params.numQuads * 6, ig::BufferUsage::Dynamic);
+		desc.VS = SHADER_VS(g_VS_SpriteTriangles);
+		desc.vertexLayout =
+		{
+			ig::VertexElement(ig::Format::FLOAT_FLOAT, "POSITION"),
+			ig::VertexElement(ig::Format::FLOAT_FLOAT, "TEXCOORD"),
+			ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "COLOR"),
+		};
+		desc.primitiveTopology = ig::PrimitiveTopology::TriangleList;
+		break;
+	}
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_Sprites::OnRender(ig::CommandList& cmd)
+{
+	SpritePushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+	pushConstants.textureIndex = atlas->GetDescriptor().heapIndex;
+	pushConstants.samplerIndex = sampler->GetDescriptor().heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+
+	switch (method)
+	{
+	case SpriteMethod::RawVertexPulling:
+		buffer->SetDynamicData(spriteQuads.data());
+		pushConstants.spriteBufferIndex = buffer->GetDescriptor().heapIndex;
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.Draw(params.numQuads * 6);
+		break;
+
+	case SpriteMethod::Instancing:
+		buffer->SetDynamicData(spriteQuads.data());
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.SetVertexBuffer(*buffer);
+		cmd.DrawInstanced(4, params.numQuads);
+		break;
+
+	default:
+	{
+		uint32_t currentVertex = 0;
+		for (uint32_t i = 0; i < params.numQuads; i++)
+		{
+			const SpriteQuad& q = spriteQuads[i];
+			const float right = q.x + q.width;
+			const float bottom = q.y + q.height;
+			vertices[currentVertex] = { q.x, q.y, q.uv.left, q.uv.top, q.color };
+			vertices[currentVertex + 1] = { right, q.y, q.uv.right, q.uv.top, q.color };
+			vertices[currentVertex + 2] = { q.x, bottom, q.uv.left, q.uv.bottom, q.color };
+			vertices[currentVertex + 3] = { q.x, bottom, q.uv.left, q.uv.bottom, q.color };
+			vertices[currentVertex + 4] = { right, q.y, q.uv.right, q.uv.top, q.color };
+			vertices[currentVertex + 5] = { right, bottom, q.uv.right, q.uv.bottom, q.color };
+			currentVertex += 6;
+		}
+		buffer->SetDynamicData(vertices.data());
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.SetVertexBuffer(*buffer);
+		cmd.Draw(buffer->GetNumElements());
+		break;
+	}
+	}
+}
+
+Benchmark_Circles::Benchmark_Circles(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+	CircleMethod method)
+	: Benchmark(context, cmd, params), method(method)
+{
+	circles = GenerateCircles(params.quads, params.numQuads);
+
+	ig::PipelineDesc desc =
+	{
+		.PS = params.premultipliedAlpha ? SHADER_PS(g_PS_CircleSDFPremultiplied) : SHADER_PS(g_PS_CircleSDF),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+
+	if (method == CircleMethod::RawVertexPulling)
+	{
+		buffer = ig::Buffer::CreateRawBuffer(context, sizeof(ig::Vertex_Circle) * params.numQuads, ig::BufferUsage::Dynamic);
+		desc.VS = SHADER_VS(g_VS_CircleRaw);
+		desc.vertexLayout = {}; // No vertex layout
+		desc.primitiveTopology = ig::PrimitiveTopology::TriangleList;
+	}
+	else
+	{
+		if (method == CircleMethod::StaticInstancing)
+		{
+			// Uploaded once
+			buffer = ig::Buffer::CreateVertexBuffer(context, sizeof(ig::Vertex_Circle), params.numQuads, ig::BufferUsage::Default);
+			buffer->SetData(cmd, circles.data());
+		}
+		else
+		{
+			buffer = ig::Buffer::CreateVertexBuffer(context, sizeof(ig::Vertex_Circle), params.numQuads, ig::BufferUsage::Dynamic);
+		}
+		desc.VS = SHADER_VS(g_VS_CircleInstanced);
+		desc.vertexLayout =
+		{
+			ig::VertexElement(ig::Format::FLOAT_FLOAT, "POSITION", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::FLOAT, "RADIUS", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::FLOAT, "SMOOTHING", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::FLOAT, "BORDERTHICKNESS", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "INNERCOLOR", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "OUTERCOLOR", 0, 0, ig::InputClass::PerInstance, 1),
+			ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "BORDERCOLOR", 0, 0, ig::InputClass::PerInstance, 1),
+		};
+		desc.primitiveTopology = ig::PrimitiveTopology::TriangleStrip; // Use triangle strips
+	}
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_Circles::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+
+	if (method == CircleMethod::RawVertexPulling)
+	{
+		buffer->SetDynamicData(circles.data());
+		pushConstants.rawOrStructuredBufferIndex = buffer->GetDescriptor().heapIndex;
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.Draw(params.numQuads * 6);
+	}
+	else
+	{
+		if (method == CircleMethod::Instancing) buffer->SetDynamicData(circles.data());
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.SetVertexBuffer(*buffer);
+		cmd.DrawInstanced(4, params.numQuads);
+	}
+}
+
+Benchmark_Text::Benchmark_Text(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+	const std::string& fontFile, ig::FontType fontType, TextStrings textStrings)
+	: Benchmark(context, cmd, params), fontType(fontType), textStrings(textStrings)
+{
+	strings = GenerateTextStrings(textCharactersPerFrame / textCharactersPerString, textCharactersPerString);
+
+	font = ig::Font::LoadFromFile(context, fontFile, textFontSize, ig::FontSettings(fontType));
+	if (!font) ig::Fatal("Failed to load font '" + fontFile + "'.");
+
+	batchRenderer = ig::BatchRenderer::Create(context, params.renderTargetDesc);
+	if (!batchRenderer) ig::Fatal("Failed to create the batch renderer.");
+
+	ig::Timer timer;
+
+	// Load all glyphs the strings use. All strings are ASCII, so each byte is a codepoint.
+	for (const std::string& str : strings)
+	{
+		font->PreloadGlyphs(str);
+	}
+	if (font->TextureIsDirty())
+	{
+		cmd.SafePauseRenderPass();
+		font->ApplyChangesToTexture(cmd);
+		cmd.SafeResumeRenderPass();
+	}
+	loadGlyphsMs = timer.GetMillisecondsAndReset();
+
+	// Glyph lookup
+	for (uint32_t pass = 0; pass < textBreakdownPasses; pass++)
+	{
+		for (const std::string& str : strings)
+		{
+			for (char c : str)
+			{
+				checksum += font->GetGlyph((uint32_t)c).advanceX;
+			}
+		}
+	}
+	glyphLookupMs = timer.GetMillisecondsAndReset() / (double)textBreakdownPasses;
+
+	// Kerning
+	for (uint32_t pass = 0; pass < textBreakdownPasses; pass++)
+	{
+		for (const std::string& str : strings)
+		{
+			uint32_t prevCodepoint = 0xffffffff;
+			for (char c : str)
+			{
+				checksum += font->GetKerning(prevCodepoint, (uint32_t)c);
+				prevCodepoint = (uint32_t)c;
+			}
+		}
+	}
+	kerningMs = timer.GetMillisecondsAndReset() / (double)textBreakdownPasses;
+}
+
+void Benchmark_Text::OnRender(ig::CommandList& cmd)
+{
+	ig::Timer timer;
+
+	if (textStrings == TextStrings::NewGlyphs)
+	{
+		// Keep the atlas bounded. The glyphs the strings use (printable ASCII) are loaded again right away.
+		if (nextNewCodepoint > textNewGlyphsLastCodepoint)
+		{
+			font->ClearTexture();
+			font->PreloadGlyphs(' ', '~');
+			nextNewCodepoint = textNewGlyphsFirstCodepoint;
+			numAtlasResets++;
+		}
+		atlasResetMs += timer.GetMillisecondsAndReset();
+
+		const uint32_t lastCodepoint = std::min(nextNewCodepoint + textNewGlyphsPerFrame - 1, textNewGlyphsLastCodepoint);
+		font->PreloadGlyphs(nextNewCodepoint, lastCodepoint);
+		rasterizeMs += timer.GetMillisecondsAndReset();
+
+		if (font->TextureIsDirty())
+		{
+			cmd.SafePauseRenderPass();
+			font->ApplyChangesToTexture(cmd);
+			cmd.SafeResumeRenderPass();
+		}
+		applyChangesMs += timer.GetMillisecondsAndReset();
+
+		// The new codepoints are all below 0x800, so each one is 2 bytes in UTF-8
+		newGlyphsString.clear();
+		for (uint32_t codepoint = nextNewCodepoint; codepoint <= lastCodepoint; codepoint++)
+		{
+			newGlyphsString.push_back((char)(0xC0 | (codepoint >> 6)));
+			newGlyphsString.push_back((char)(0x80 | (codepoint & 0x3F)));
+		}
+		nextNewCodepoint = lastCodepoint + 1;
+	}
+
+	const float lineHeight = (float)(font->GetFontDesc().lineHeight + font->GetFontDesc().lineGap);
+	const uint32_t linesPerScreen = std::max(1u, (uint32_t)((float)params.viewExtent.height / lineHeight));
+	batchRenderer->Begin(cmd);
+	for (uint32_t i = 0; i < (uint32_t)strings.size(); i++)
+	{
+		batchRenderer->DrawString(0, (float)(i % linesPerScreen) * lineHeight, strings[i], *font, ig::Colors::White);
+	}
+	if (!newGlyphsString.empty())
+	{
+		batchRenderer->DrawString(0, 0, newGlyphsString, *font, ig::Colors::White);
+	}
+	batchRenderer->End();
+	drawStringMs += timer.GetMillisecondsAndReset();
+
+	numFramesRendered++;
+}
+
+std::string Benchmark_Text::GetResults(double fps) const
+{
+	if (numFramesRendered == 0) return "";
+	const double frames = (double)numFramesRendered;
+	const uint32_t glyphsPerFrame = textCharactersPerFrame + ((textStrings == TextStrings::NewGlyphs) ? textNewGlyphsPerFrame : 0);
+	std::string out = ig::ToString
+	(
+		"Glyphs/s: ", (double)glyphsPerFrame * fps, "\n",
+		"CPU time per frame: DrawString ", drawStringMs / frames, " ms\n"
+	);
+	if (textStrings == TextStrings::NewGlyphs)
+	{
+		out += ig::ToString
+		(
+			"CPU time per frame for ", textNewGlyphsPerFrame, " new glyphs: rasterization ", rasterizeMs / frames,
+			" ms, ApplyChangesToTexture ", applyChangesMs / frames, " ms, atlas resets ", atlasResetMs / frames,
+			" ms (", numAtlasResets, " resets)\n"
+		);
+	}
+	out += ig::ToString
+	(
+		"Estimated CPU time per pass over all strings, measured before the frames (not a per frame cost): glyph lookup ",
+		glyphLookupMs, " ms, kerning ", kerningMs, " ms. Loading the glyphs of the strings took ", loadGlyphsMs, " ms\n"
+	);
+	return out;
+}
+
+Benchmark_Billboards::Benchmark_Billboards(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+	BillboardCulling culling)
+	: Benchmark(context, cmd, params), culling(culling)
+{
+	billboards = GenerateBillboards(params.quads, params.numQuads, params.viewExtent);
+
+	camera.SetProjection((float)params.viewExtent.width / (float)params.viewExtent.height, 90.0f, 0.1f, 1000.0f);
+	camera.SetPosition(0, billboardMaxHeight * 0.5f, 0);
+	cameraConstants = GetBillboardCameraConstants(camera);
+
+	if (culling == BillboardCulling::CPU)
+	{
+		visibleBillboards.resize(params.numQuads);
+		rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Billboard) * params.numQuads, ig::BufferUsage::Dynamic);
+	}
+	else
+	{
+		numVisibleBillboards = params.numQuads;
+		rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(Billboard) * params.numQuads, ig::BufferUsage::Default);
+		rawBuffer->SetData(cmd, billboards.data());
+	}
+
+	ig::PipelineDesc desc =
+	{
+		.VS = (culling == BillboardCulling::GPU) ? SHADER_VS(g_VS_BillboardRectCulled) : SHADER_VS(g_VS_BillboardRect),
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = ig::DepthDesc::DepthEnabled, // The app binds a depth buffer in every run
+		.vertexLayout = {}, // No vertex layout
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+	desc.renderTargetDesc.depthFormat = depthBufferFormat;
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_Billboards::OnUpdate()
+{
+	camera.ApplyYaw(billboardCameraYawPerFrame);
+	cameraConstants = GetBillboardCameraConstants(camera);
+
+	if (culling == BillboardCulling::CPU)
+	{
+		numVisibleBillboards = 0;
+		for (uint32_t i = 0; i < params.numQuads; i++)
+		{
+			if (IsBillboardInFrustum(billboards[i], cameraConstants))
+			{
+				visibleBillboards[numVisibleBillboards] = billboards[i];
+				numVisibleBillboards++;
+			}
+		}
+	}
+}
+
+void Benchmark_Billboards::OnRender(ig::CommandList& cmd)
+{
+	if (numVisibleBillboards == 0) return;
+
+	if (culling == BillboardCulling::CPU)
+	{
+		rawBuffer->SetDynamicData(visibleBillboards.data(), sizeof(Billboard) * numVisibleBillboards);
+	}
+
+	BillboardPushConstants pushConstants;
+	pushConstants.billboardBufferIndex = rawBuffer->GetDescriptor().heapIndex;
+	pushConstants.cameraConstantsIndex = context.CreateTempConstant(&cameraConstants, sizeof(cameraConstants)).heapIndex;
+
+	cmd.SetPipeline(*pipeline);
+	cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+	cmd.Draw(numVisibleBillboards * 6);
+}
+
+Benchmark_TransformedQuads::Benchmark_TransformedQuads(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+	bool gpuTransform)
+	: Benchmark(context, cmd, params), gpuTransform(gpuTransform)
+{
+	transformedQuads = GenerateTransformedQuads(params.quads, params.numQuads);
+
+	ig::PipelineDesc desc =
+	{
+		.PS = SHADER_PS(g_PS_Color),
+		.blendStates = { params.blendState },
+		.rasterizerState = params.rasterizerState,
+		.depthState = params.depthState,
+		.primitiveTopology = ig::PrimitiveTopology::TriangleList,
+		.renderTargetDesc = params.renderTargetDesc,
+	};
+
+	if (gpuTransform)
+	{
+		rawBuffer = ig::Buffer::CreateRawBuffer(context, sizeof(TransformedQuad) * params.numQuads, ig::BufferUsage::Dynamic);
+		desc.VS = SHADER_VS(g_VS_TransformedRect); // Raw vertex pulling shader that rotates the corners
+		desc.vertexLayout = {}; // No vertex layout
+	}
+	else
+	{
+		vertices = std::vector<Vertex>(params.numQuads * 6);
+		vertexBuffer = ig::Buffer::CreateVertexBuffer(context, sizeof(Vertex), params.numQuads * 6, ig::BufferUsage::Dynamic);
+		desc.VS = SHADER_VS(g_VS_Triangles);
+		desc.vertexLayout =
+		{
+			ig::VertexElement(ig::Format::FLOAT_FLOAT, "POSITION"),
+			ig::VertexElement(ig::Format::BYTE_BYTE_BYTE_BYTE, "COLOR"),
+		};
+	}
+	pipeline = ig::Pipeline::CreateGraphics(context, desc);
+}
+
+void Benchmark_TransformedQuads::OnRender(ig::CommandList& cmd)
+{
+	PushConstants pushConstants;
+	pushConstants.screenSize = ig::Vector2((float)params.viewExtent.width, (float)params.viewExtent.height);
+
+	cmd.SetPipeline(*pipeline);
+
+	if (gpuTransform)
+	{
+		// Only the angle changes, the corners are computed in the vertex shader
+		rawBuffer->SetDynamicData(transformedQuads.data());
+		pushConstants.rawOrStructuredBufferIndex = rawBuffer->GetDescriptor().heapIndex;
+
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.Draw(params.numQuads * 6);
+	}
+	else
+	{
+		// Rotate the corners around the center of each quad
+		uint32_t currentVertex = 0;
+		for (uint32_t i = 0; i < params.numQuads; i++)
+		{
+			const TransformedQuad& q = transformedQuads[i];
+			const float halfWidth = q.width * 0.5f;
+			const float halfHeight = q.height * 0.5f;
+			const float centerX = q.x + halfWidth;
+			const float centerY = q.y + halfHeight;
+			const float s = std::sin(q.rotation);
+			const float c = std::cos(q.rotation);
+
+			// The rotated half extents along the quad's own X and Y axes
+			const float xAxisX = halfWidth * c;
+			const float xAxisY = halfWidth * s;
+			const float yAxisX = -halfHeight * s;
+			const float yAxisY = halfHeight * c;
+
+			const Vertex topLeft = { centerX - xAxisX - yAxisX, centerY - xAxisY - yAxisY, q.color };
+			const Vertex topRight = { centerX + xAxisX - yAxisX, centerY + xAxisY - yAxisY, q.color };
+			const Vertex bottomLeft = { centerX - xAxisX + yAxisX, centerY - xAxisY + yAxisY, q.color };
+			const Vertex bottomRight = { centerX + xAxisX + yAxisX, centerY + xAxisY + yAxisY, q.color };
+
+			vertices[currentVertex] = topLeft;
+			vertices[currentVertex + 1] = topRight;
+			vertices[currentVertex + 2] = bottomLeft;
+			vertices[currentVertex + 3] = bottomLeft;
+			vertices[currentVertex + 4] = topRight;
+			vertices[currentVertex + 5] = bottomRight;
+			currentVertex += 6;
+		}
+		vertexBuffer->SetDynamicData(vertices.data());
+
+		cmd.SetPushConstants(&pushConstants, sizeof(pushConstants));
+		cmd.SetVertexBuffer(*vertexBuffer);
+		cmd.Draw(vertexBuffer->GetNumElements());
+	}
+}
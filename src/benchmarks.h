@@ -1,5 +1,9 @@
 #pragma once
 
+#include "iglo_camera.h"
+#include "iglo_font.h"
+#include "iglo_batch_renderer.h"
+
 struct Vertex
 {
 	float x = 0;
@@ -30,21 +34,231 @@ struct StructuredQuad
 using StructuredQuad = Quad;
 #endif
 
+// Alternative quad record layouts for raw and structured vertex pulling.
+// Must match RECORD_SIZE in VS_VertexPulledRect.hlsl.
+
+// 16 bytes, loaded with a single Load4. Width and height are stored as 16-bit integers.
+struct PackedQuad16
+{
+	float x = 0;
+	float y = 0;
+	uint16_t width = 0;
+	uint16_t height = 0;
+	ig::Color32 color = ig::Colors::Black;
+
+	static constexpr const char* layoutName = "16 byte records";
+	static PackedQuad16 FromQuad(const Quad& q)
+	{
+		return PackedQuad16{ q.x, q.y, (uint16_t)q.width, (uint16_t)q.height, q.color };
+	}
+};
+static_assert(sizeof(PackedQuad16) == 16);
+
+// 32 bytes, loaded with two Load4. Same data as Quad, padded to a 32 byte stride.
+struct AlignedQuad32
+{
+	float x = 0;
+	float y = 0;
+	float width = 0;
+	float height = 0;
+	ig::Color32 color = ig::Colors::Black;
+	uint32_t padding[3] = {};
+
+	static constexpr const char* layoutName = "32 byte records";
+	static AlignedQuad32 FromQuad(const Quad& q)
+	{
+		return AlignedQuad32{ q.x, q.y, q.width, q.height, q.color };
+	}
+};
+static_assert(sizeof(AlignedQuad32) == 32);
+
+// A quad rotated around its center. Must match the 24 byte layout in VS_TransformedRect.hlsl.
+struct TransformedQuad
+{
+	float x = 0;
+	float y = 0;
+	float width = 0;
+	float height = 0;
+	float rotation = 0; // Radians
+	ig::Color32 color = ig::Colors::Black;
+};
+static_assert(sizeof(TransformedQuad) == 24);
+
+// A textured quad with a UV rectangle into the sprite atlas. Must match the 36 byte layout in VS_Sprite.hlsl.
+struct SpriteQuad
+{
+	float x = 0;
+	float y = 0;
+	float width = 0;
+	float height = 0;
+	ig::FloatRect uv;
+	ig::Color32 color = ig::Colors::Black;
+};
+static_assert(sizeof(SpriteQuad) == 36);
+
+struct SpriteVertex
+{
+	float x = 0;
+	float y = 0;
+	float u = 0;
+	float v = 0;
+	ig::Color32 color = ig::Colors::Black;
+};
+
+// Circles use the same record as BatchRenderer::DrawCircle. Must match the 32 byte layout in VS_Circle.hlsl.
+static_assert(sizeof(ig::Vertex_Circle) == 32);
+
+// A camera-facing quad in world space. Must match the 20 byte layout in VS_BillboardRect.hlsl.
+struct Billboard
+{
+	ig::Vector3 position;
+	float size = 0;
+	ig::Color32 color = ig::Colors::Black;
+};
+static_assert(sizeof(Billboard) == 20);
+
 struct PushConstants
 {
 	uint32_t rawOrStructuredBufferIndex = IGLO_UINT32_MAX;
 	ig::Vector2 screenSize;
 };
 
-void UpdateQuadsCPU(ig::Extent2D viewExtent, Quad* quads_CPU, uint32_t numQuads);
-void UpdateStructuredQuadsCPU(ig::Extent2D viewExtent, StructuredQuad* quads_CPU, uint32_t numQuads);
+struct AddressPushConstants
+{
+	uint64_t bufferAddress = 0;
+	ig::Vector2 screenSize;
+};
+
+struct QuadPushConstants
+{
+	ig::Vector2 screenSize;
+	Quad quad;
+};
+
+struct ExpandPushConstants
+{
+	uint32_t srcQuadBufferIndex = IGLO_UINT32_MAX;
+	uint32_t destVertexBufferIndex = IGLO_UINT32_MAX;
+	uint32_t numQuads = 0;
+};
+
+struct ProceduralPushConstants
+{
+	uint32_t seed = 0;
+	float quadSize = 0;
+	ig::Vector2 screenSize;
+};
+
+struct SpritePushConstants
+{
+	ig::Vector2 screenSize;
+	uint32_t spriteBufferIndex = IGLO_UINT32_MAX; // Only used by raw vertex pulling
+	uint32_t textureIndex = IGLO_UINT32_MAX;
+	uint32_t samplerIndex = IGLO_UINT32_MAX;
+};
+
+struct BillboardPushConstants
+{
+	uint32_t billboardBufferIndex = IGLO_UINT32_MAX;
+	uint32_t cameraConstantsIndex = IGLO_UINT32_MAX;
+};
+
+// Uploaded each frame as a temp constant. Must match CameraConstants in VS_BillboardRect.hlsl.
+struct BillboardCameraConstants
+{
+	ig::Matrix4x4 viewProj; // Transposed
+	ig::Vector4 cameraRight;
+	ig::Vector4 cameraUp;
+	ig::Vector4 frustumPlanes[6]; // Normalized, pointing into the frustum
+};
+
+// Quads are tightly packed into 64 KB constant buffer chunks.
+// Every chunk is bound as a full 64 KB constant buffer to match the block declared in VS_ConstantBufferRect.hlsl,
+// so the last chunk is padded.
+constexpr uint32_t constantChunkByteSize = 64 * 1024;
+constexpr uint32_t quadsPerConstantChunk = constantChunkByteSize / sizeof(Quad);
+
+// Each texture row holds this many quads, 5 texels (32-bit each) per quad.
+constexpr uint32_t textureQuadsPerRow = 2048;
+
+// If 'keepMortonOrder' is true, an incremental re-sort step keeps the moving quads nearly sorted in Morton order.
+void UpdateQuadsCPU(ig::Extent2D viewExtent, Quad* quads_CPU, uint32_t numQuads, bool keepMortonOrder = false);
+void UpdateStructuredQuadsCPU(ig::Extent2D viewExtent, StructuredQuad* quads_CPU, uint32_t numQuads, bool keepMortonOrder = false);
+
+// Sorts quads along a Z-order curve of their position, so consecutive quads are close to each other on screen.
+void SortQuadsMortonOrder(Quad* quads_CPU, uint32_t numQuads);
+
+// Transformed quads are made from the quads, with a random rotation and a random scale from 0.5 to 1.5.
+constexpr float transformedQuadRotationPerFrame = 0.01f; // Radians
+std::vector<TransformedQuad> GenerateTransformedQuads(const Quad* quads_CPU, uint32_t numQuads);
+void UpdateTransformedQuadsCPU(ig::Extent2D viewExtent, TransformedQuad* quads_CPU, uint32_t numQuads);
+
+// The sprite atlas is a generated texture with a grid of round sprites that are transparent around the edges.
+// Each sprite quad picks one of the sprites.
+// If 'premultipliedAlpha' is true, the colors of the atlas are premultiplied by their alpha, like the quad colors.
+constexpr uint32_t spriteAtlasSize = 256;
+constexpr uint32_t spriteAtlasCellsPerRow = 4;
+std::unique_ptr<ig::Texture> CreateSpriteAtlas(const ig::IGLOContext& context, ig::CommandList& cmd, bool premultipliedAlpha);
+std::vector<SpriteQuad> GenerateSpriteQuads(const Quad* quads_CPU, uint32_t numQuads);
+void UpdateSpriteQuadsCPU(ig::Extent2D viewExtent, SpriteQuad* quads_CPU, uint32_t numQuads);
+
+// Each quad becomes a circle of the same size, with a radial gradient and an anti aliased edge.
+std::vector<ig::Vertex_Circle> GenerateCircles(const Quad* quads_CPU, uint32_t numQuads);
+void UpdateCirclesCPU(ig::Extent2D viewExtent, ig::Vertex_Circle* circles_CPU, uint32_t numCircles);
+
+// The text benchmarks draw ASCII strings with a dynamic font loaded from a TrueType file.
+// Returns an empty string if none of the usual system font files exist.
+constexpr uint32_t textCharactersPerFrame = 100'000;
+constexpr uint32_t textCharactersPerString = 100;
+constexpr float textFontSize = 16.0f;
+constexpr uint32_t textBreakdownPasses = 10; // Passes per step of the CPU time breakdown
+std::string FindTextFontFile();
+std::vector<std::string> GenerateTextStrings(uint32_t numStrings, uint32_t charactersPerString);
+
+// Changes every letter and digit to the next one, so the strings and their kerning pairs are different each frame.
+// The strings keep using the same ASCII letters and digits, so no new glyphs need to be loaded.
+void UpdateTextStringsCPU(std::vector<std::string>& strings);
+
+// The new glyphs variant of the text benchmarks rasterizes this many new codepoints per frame.
+// They cycle through Latin-1 Supplement and Latin Extended-A. When the range wraps around, the glyph atlas
+// is cleared so it stays bounded.
+constexpr uint32_t textNewGlyphsPerFrame = 8;
+constexpr uint32_t textNewGlyphsFirstCodepoint = 0xC0;
+constexpr uint32_t textNewGlyphsLastCodepoint = 0x17F;
+
+// The quads are spread out as billboards over a square field in world space.
+// Their screen position becomes their XZ position, and the quad size in pixels is scaled to world units.
+constexpr float billboardFieldHalfExtent = 100.0f;
+constexpr float billboardMaxHeight = 10.0f;
+constexpr float billboardWorldUnitsPerPixel = 0.05f;
+constexpr float billboardCameraYawPerFrame = 0.01f; // Radians
+std::vector<Billboard> GenerateBillboards(const Quad* quads_CPU, uint32_t numQuads, ig::Extent2D viewExtent);
+
+// Computes the constants of the camera, including its frustum planes.
+BillboardCameraConstants GetBillboardCameraConstants(ig::BaseCamera& camera);
+bool IsBillboardInFrustum(const Billboard& billboard, const BillboardCameraConstants& constants);
+
+// The format of the depth buffer the app binds in depth tested runs and for benchmarks that require depth.
+constexpr ig::Format depthBufferFormat = ig::Format::DEPTHFORMAT_FLOAT;
 
 struct BenchmarkParams
 {
 	Quad* quads = nullptr;
 	StructuredQuad* structuredQuads = nullptr;
 	uint32_t numQuads = 0;
+	float quadSize = 0;
 	ig::Extent2D viewExtent;
+	ig::RasterizerDesc rasterizerState = ig::RasterizerDesc::NoCull; // Used by all benchmark pipelines
+	bool mortonOrder = false; // Quads are sorted in Morton order and kept nearly sorted as they move
+
+	// Used by all benchmark pipelines. The app binds a depth buffer if 'renderTargetDesc' has a depth format.
+	// All quads are drawn at the same depth, so with a Less test the first quad drawn at a pixel hides the rest.
+	ig::RenderTargetDesc renderTargetDesc;
+	ig::DepthDesc depthState = ig::DepthDesc::DepthDisabled;
+
+	// Used by all benchmark pipelines. The quad colors have random alpha, which is only visible when blending.
+	ig::BlendDesc blendState = ig::BlendDesc::BlendDisabled;
+	bool premultipliedAlpha = false; // Quad colors are premultiplied by their alpha
 };
 
 class Benchmark
@@ -58,6 +272,17 @@ public:
 	virtual void OnUpdate() {};
 	virtual void OnRender(ig::CommandList&) {};
 
+	// Extra results printed after the FPS, for benchmarks that measure more than the frame rate.
+	virtual std::string GetResults(double fps) const { return ""; };
+
+	// If true, the app binds a depth buffer of 'depthBufferFormat' in every run, not only in depth tested runs.
+	virtual bool RequiresDepthBuffer() const { return false; };
+
+	// Must be true if OnRender() pauses the render pass (copies, uploads or compute work).
+	// The app then stores the attachments even in runs with StoreOp::DontCare, since a paused render pass
+	// must keep its contents to be resumed.
+	virtual bool PausesRenderPass() const { return false; };
+
 	const ig::IGLOContext& context;
 	const BenchmarkParams params;
 };
@@ -83,7 +308,23 @@ public:
 
 	void OnUpdate()
 	{
-		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads);
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_PushConstantDrawCall : public Benchmark
+{
+public:
+	Benchmark_PushConstantDrawCall(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "One draw call per quad (push constants)"; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
 	};
 	void OnRender(ig::CommandList&) override;
 
@@ -99,7 +340,7 @@ public:
 
 	void OnUpdate()
 	{
-		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads);
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
 	};
 	void OnRender(ig::CommandList&) override;
 
@@ -117,7 +358,7 @@ public:
 
 	void OnUpdate()
 	{
-		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads);
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
 	};
 	void OnRender(ig::CommandList&) override;
 
@@ -137,7 +378,7 @@ public:
 
 	void OnUpdate()
 	{
-		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads);
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
 	};
 	void OnRender(ig::CommandList&) override;
 
@@ -156,7 +397,26 @@ public:
 
 	void OnUpdate()
 	{
-		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads);
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Buffer> rawBuffer;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+#ifdef IGLO_VULKAN
+// Raw vertex pulling through a buffer device address instead of a bindless descriptor.
+class Benchmark_AddressVertexPulling : public Benchmark
+{
+public:
+	Benchmark_AddressVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Buffer Device Address Vertex Pulling"; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
 	};
 	void OnRender(ig::CommandList&) override;
 
@@ -164,6 +424,7 @@ private:
 	std::unique_ptr<ig::Buffer> rawBuffer;
 	std::unique_ptr<ig::Pipeline> pipeline;
 };
+#endif
 
 class Benchmark_StructuredVertexPulling : public Benchmark
 {
@@ -173,7 +434,7 @@ public:
 
 	void OnUpdate()
 	{
-		UpdateStructuredQuadsCPU(params.viewExtent, params.structuredQuads, params.numQuads);
+		UpdateStructuredQuadsCPU(params.viewExtent, params.structuredQuads, params.numQuads, params.mortonOrder);
 	};
 	void OnRender(ig::CommandList&) override;
 
@@ -182,6 +443,42 @@ private:
 	std::unique_ptr<ig::Pipeline> pipeline;
 };
 
+class Benchmark_TypedVertexPulling : public Benchmark
+{
+public:
+	Benchmark_TypedVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Typed Vertex Pulling"; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Buffer> typedBuffer;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_TextureVertexPulling : public Benchmark
+{
+public:
+	Benchmark_TextureVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Texture Vertex Pulling"; }
+	bool PausesRenderPass() const override { return true; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::vector<Quad> texels; // Quads padded to fill the last texture row
+	std::unique_ptr<ig::Texture> texture;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
 class Benchmark_Instancing : public Benchmark
 {
 public:
@@ -190,7 +487,7 @@ public:
 
 	void OnUpdate()
 	{
-		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads);
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
 	};
 	void OnRender(ig::CommandList&) override;
 
@@ -199,6 +496,116 @@ private:
 	std::unique_ptr<ig::Pipeline> pipeline;
 };
 
+class Benchmark_ConstantBufferInstancing : public Benchmark
+{
+public:
+	Benchmark_ConstantBufferInstancing(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Constant Buffer Instancing"; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::vector<uint8_t> paddedChunk; // Used for chunks that would otherwise read past the end of the quads
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_ComputeExpansion : public Benchmark
+{
+public:
+	Benchmark_ComputeExpansion(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Compute Expanded Triangle List"; }
+	bool PausesRenderPass() const override { return true; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Buffer> rawBuffer;
+	std::unique_ptr<ig::Buffer> vertexBuffer; // Written by the compute shader
+	std::unique_ptr<ig::Pipeline> computePipeline;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_RawVertexPullingCopy : public Benchmark
+{
+public:
+	Benchmark_RawVertexPullingCopy(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Raw Vertex Pulling (Upload + Copy)"; }
+	bool PausesRenderPass() const override { return true; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Buffer> rawBuffer; // Device-local
+	std::unique_ptr<ig::Buffer> stagingBuffer; // Dynamic, one copy per frame in flight
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_InstancingCopy : public Benchmark
+{
+public:
+	Benchmark_InstancingCopy(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Instancing (Upload + Copy)"; }
+	bool PausesRenderPass() const override { return true; }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Buffer> vertexBuffer; // Device-local
+	std::unique_ptr<ig::Buffer> stagingBuffer; // Dynamic, one copy per frame in flight
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_ChunkedVertexPulling : public Benchmark
+{
+public:
+	Benchmark_ChunkedVertexPulling(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, uint32_t numChunks);
+	std::string GetName() const override { return ig::ToString("Chunked Raw Vertex Pulling (", numChunks, " chunks)"); }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	uint32_t numChunks = 1;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_DrawGranularity : public Benchmark
+{
+public:
+	Benchmark_DrawGranularity(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, uint32_t quadsPerDraw);
+	std::string GetName() const override { return ig::ToString("Instancing (", quadsPerDraw, " quads per draw call)"); }
+
+	void OnUpdate()
+	{
+		UpdateQuadsCPU(params.viewExtent, params.quads, params.numQuads, params.mortonOrder);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	uint32_t quadsPerDraw = 1;
+	std::unique_ptr<ig::Buffer> vertexBuffer;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
 class Benchmark_GPUTriangles : public Benchmark
 {
 public:
@@ -229,8 +636,30 @@ private:
 class Benchmark_GPURaw : public Benchmark
 {
 public:
-	Benchmark_GPURaw(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
-	std::string GetName() const override { return "Rendering only (Raw Vertex Pulling)"; }
+	// 'halfPrecision' uses a shader that decodes quads with 16-bit float arithmetic.
+	// Only use it if GraphicsSpecs::supportedShaderFeatures.float16 is true.
+	Benchmark_GPURaw(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, bool halfPrecision = false);
+	std::string GetName() const override
+	{
+		return halfPrecision ? "Rendering only (Raw Vertex Pulling, fp16)" : "Rendering only (Raw Vertex Pulling)";
+	}
+
+	void OnRender(ig::CommandList&) override;
+
+private:
+	bool halfPrecision = false;
+	std::unique_ptr<ig::Buffer> rawBuffer;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+// Only one vertex per quad loads the quad, the rest read it from that lane with WaveReadLaneAt.
+// Vertices whose first vertex is not an active lane of the same wave load the quad themselves.
+// Only use it if GraphicsSpecs::supportedShaderFeatures.waveOps is true.
+class Benchmark_GPUWaveRaw : public Benchmark
+{
+public:
+	Benchmark_GPUWaveRaw(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Rendering only (Raw Vertex Pulling, wave shared loads)"; }
 
 	void OnRender(ig::CommandList&) override;
 
@@ -239,6 +668,40 @@ private:
 	std::unique_ptr<ig::Pipeline> pipeline;
 };
 
+// Raw or structured vertex pulling with one of the alternative record layouts (PackedQuad16 or AlignedQuad32).
+template <typename Record>
+class Benchmark_GPURecordLayout : public Benchmark
+{
+public:
+	Benchmark_GPURecordLayout(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, bool structured);
+	std::string GetName() const override
+	{
+		return ig::ToString("Rendering only (", structured ? "Structured" : "Raw", " Vertex Pulling, ", Record::layoutName, ")");
+	}
+
+	void OnRender(ig::CommandList&) override;
+
+private:
+	bool structured = false;
+	std::unique_ptr<ig::Buffer> buffer;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+#ifdef IGLO_VULKAN
+class Benchmark_GPUAddress : public Benchmark
+{
+public:
+	Benchmark_GPUAddress(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Rendering only (Buffer Device Address Vertex Pulling)"; }
+
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Buffer> rawBuffer;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+#endif
+
 class Benchmark_GPUStructured : public Benchmark
 {
 public:
@@ -252,15 +715,267 @@ private:
 	std::unique_ptr<ig::Pipeline> pipeline;
 };
 
+class Benchmark_GPUTyped : public Benchmark
+{
+public:
+	Benchmark_GPUTyped(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Rendering only (Typed Vertex Pulling)"; }
+
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Buffer> typedBuffer;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_GPUTexture : public Benchmark
+{
+public:
+	Benchmark_GPUTexture(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Rendering only (Texture Vertex Pulling)"; }
+
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Texture> texture;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
 class Benchmark_GPUInstancing : public Benchmark
 {
 public:
-	Benchmark_GPUInstancing(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
-	std::string GetName() const override { return "Rendering only (Instancing)"; }
+	Benchmark_GPUInstancing(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, bool halfPrecision = false);
+	std::string GetName() const override
+	{
+		return halfPrecision ? "Rendering only (Instancing, fp16)" : "Rendering only (Instancing)";
+	}
 
 	void OnRender(ig::CommandList&) override;
 
 private:
+	bool halfPrecision = false;
 	std::unique_ptr<ig::Buffer> vertexBuffer;
 	std::unique_ptr<ig::Pipeline> pipeline;
 };
+
+class Benchmark_GPUConstantBuffer : public Benchmark
+{
+public:
+	Benchmark_GPUConstantBuffer(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Rendering only (Constant Buffer Instancing)"; }
+
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::vector<std::unique_ptr<ig::Buffer>> constantBuffers; // One per chunk
+	std::vector<uint32_t> numQuadsPerChunk;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+class Benchmark_GPUProcedural : public Benchmark
+{
+public:
+	Benchmark_GPUProcedural(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params);
+	std::string GetName() const override { return "Rendering only (Procedural, no quad buffer)"; }
+
+	void OnRender(ig::CommandList&) override;
+
+private:
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+// Quads with a per-quad rotation and scale, like Vertex_TransformedSprite in iglo_batch_renderer.h.
+// The corners are either computed on the CPU (sin/cos per quad) or in the vertex shader (only the angle is uploaded).
+class Benchmark_TransformedQuads : public Benchmark
+{
+public:
+	Benchmark_TransformedQuads(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, bool gpuTransform);
+	std::string GetName() const override
+	{
+		return gpuTransform ? "Rotated Quads (GPU transform, Raw Vertex Pulling)" : "Rotated Quads (CPU transform, Batched Triangle List)";
+	}
+
+	void OnUpdate()
+	{
+		UpdateTransformedQuadsCPU(params.viewExtent, transformedQuads.data(), params.numQuads);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	bool gpuTransform = false;
+	std::vector<TransformedQuad> transformedQuads;
+	std::vector<Vertex> vertices; // Only used with CPU transform
+	std::unique_ptr<ig::Buffer> vertexBuffer; // Only used with CPU transform
+	std::unique_ptr<ig::Buffer> rawBuffer; // Only used with GPU transform
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+enum class SpriteMethod
+{
+	BatchedTriangleList = 0,
+	RawVertexPulling,
+	Instancing,
+};
+
+// Textured quads that sample the sprite atlas through a bindless texture index.
+class Benchmark_Sprites : public Benchmark
+{
+public:
+	Benchmark_Sprites(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, SpriteMethod method);
+	std::string GetName() const override
+	{
+		switch (method)
+		{
+		case SpriteMethod::RawVertexPulling: return "Textured Sprites (Raw Vertex Pulling)";
+		case SpriteMethod::Instancing: return "Textured Sprites (Instancing)";
+		default: return "Textured Sprites (Batched Triangle List)";
+		}
+	}
+
+	void OnUpdate()
+	{
+		UpdateSpriteQuadsCPU(params.viewExtent, spriteQuads.data(), params.numQuads);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	SpriteMethod method = SpriteMethod::BatchedTriangleList;
+	std::vector<SpriteQuad> spriteQuads;
+	std::vector<SpriteVertex> vertices; // Only used by the batched triangle list
+	std::unique_ptr<ig::Buffer> buffer; // Vertex buffer or raw buffer, depending on the method
+	std::unique_ptr<ig::Texture> atlas;
+	std::unique_ptr<ig::Sampler> sampler;
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+enum class CircleMethod
+{
+	Instancing = 0,
+	RawVertexPulling,
+	StaticInstancing, // Rendering only
+};
+
+// Circles have a heavier pixel shader than the quads. The pixel shader (PS_CircleSDF) does the same work as iglo's PS_Circle.
+class Benchmark_Circles : public Benchmark
+{
+public:
+	Benchmark_Circles(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, CircleMethod method);
+	std::string GetName() const override
+	{
+		switch (method)
+		{
+		case CircleMethod::RawVertexPulling: return "Circles (Raw Vertex Pulling)";
+		case CircleMethod::StaticInstancing: return "Circles (Rendering only, Instancing)";
+		default: return "Circles (Instancing)";
+		}
+	}
+
+	void OnUpdate()
+	{
+		if (method != CircleMethod::StaticInstancing) UpdateCirclesCPU(params.viewExtent, circles.data(), params.numQuads);
+	};
+	void OnRender(ig::CommandList&) override;
+
+private:
+	CircleMethod method = CircleMethod::Instancing;
+	std::vector<ig::Vertex_Circle> circles;
+	std::unique_ptr<ig::Buffer> buffer; // Vertex buffer or raw buffer, depending on the method
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
+
+enum class TextStrings
+{
+	Static = 0,
+	Changing, // UpdateTextStringsCPU() each frame. Same glyphs, but different strings and kerning pairs
+	NewGlyphs, // Static strings plus one string per frame with textNewGlyphsPerFrame glyphs that haven't been loaded
+};
+
+// Draws textCharactersPerFrame characters per frame with BatchRenderer::DrawString.
+// The batch renderer uses its own pipelines, so the rasterizer, depth and blend options of a run don't apply.
+// Glyph lookup and kerning are estimated in the constructor with separate passes over the strings, outside the timed frames,
+// so the frames only do the DrawString work. The constructor also loads the glyphs of the strings.
+// With TextStrings::NewGlyphs, the new glyphs are rasterized and uploaded with ApplyChangesToTexture each frame,
+// and both steps are timed separately.
+class Benchmark_Text : public Benchmark
+{
+public:
+	Benchmark_Text(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params,
+		const std::string& fontFile, ig::FontType fontType, TextStrings textStrings);
+	std::string GetName() const override
+	{
+		const char* stringsName = "static strings";
+		if (textStrings == TextStrings::Changing) stringsName = "strings change every frame";
+		if (textStrings == TextStrings::NewGlyphs) stringsName = "new glyphs every frame";
+		return ig::ToString("Text (", (fontType == ig::FontType::SDF) ? "SDF" : "Mono", " font, ", stringsName, ")");
+	}
+	bool PausesRenderPass() const override { return true; }
+
+	void OnUpdate()
+	{
+		if (textStrings == TextStrings::Changing) UpdateTextStringsCPU(strings);
+	};
+	void OnRender(ig::CommandList&) override;
+	std::string GetResults(double fps) const override;
+
+private:
+	ig::FontType fontType = ig::FontType::Bitmap;
+	TextStrings textStrings = TextStrings::Static;
+	std::vector<std::string> strings;
+	std::string newGlyphsString; // Only used with TextStrings::NewGlyphs
+	uint32_t nextNewCodepoint = textNewGlyphsFirstCodepoint;
+	std::unique_ptr<ig::Font> font;
+	std::unique_ptr<ig::BatchRenderer> batchRenderer;
+
+	// Measured once in the constructor
+	double loadGlyphsMs = 0; // Rasterizing the glyphs of the strings and ApplyChangesToTexture
+	double glyphLookupMs = 0; // Per pass over all strings
+	double kerningMs = 0; // Per pass over all strings
+	int64_t checksum = 0; // Keeps the lookup and kerning passes from being optimized away
+
+	// Accumulated over all rendered frames
+	uint32_t numFramesRendered = 0;
+	double drawStringMs = 0;
+	double rasterizeMs = 0; // New glyphs only
+	double applyChangesMs = 0; // New glyphs only
+	double atlasResetMs = 0; // New glyphs only. Clearing the atlas and rasterizing the glyphs of the strings again
+	uint32_t numAtlasResets = 0;
+};
+
+enum class BillboardCulling
+{
+	None = 0,
+	CPU, // Visible billboards are gathered on the CPU and uploaded each frame
+	GPU, // The vertex shader collapses billboards that are outside the frustum
+};
+
+// The quads as 3D billboards, seen by a camera that turns around in the center of the field.
+// Only the camera moves, the billboards are static. They are always depth tested, since they overlap in 3D.
+class Benchmark_Billboards : public Benchmark
+{
+public:
+	Benchmark_Billboards(const ig::IGLOContext& context, ig::CommandList& cmd, const BenchmarkParams& params, BillboardCulling culling);
+	std::string GetName() const override
+	{
+		switch (culling)
+		{
+		case BillboardCulling::CPU: return "3D Billboards (CPU frustum culling)";
+		case BillboardCulling::GPU: return "3D Billboards (GPU frustum culling)";
+		default: return "3D Billboards (no culling)";
+		}
+	}
+
+	bool RequiresDepthBuffer() const override { return true; }
+
+	void OnUpdate() override;
+	void OnRender(ig::CommandList&) override;
+
+private:
+	BillboardCulling culling = BillboardCulling::None;
+	ig::BaseCamera camera;
+	BillboardCameraConstants cameraConstants;
+	std::vector<Billboard> billboards;
+	std::vector<Billboard> visibleBillboards; // Only used with CPU culling
+	uint32_t numVisibleBillboards = 0;
+	std::unique_ptr<ig::Buffer> rawBuffer; // Dynamic with CPU culling
+	std::unique_ptr<ig::Pipeline> pipeline;
+};
@@ -25,6 +25,23 @@ class App
 {
 public:
 
+	void EnableAllRuns()
+	{
+		runRasterizerDiscard = true;
+		quadSizeVariants = { 0, 8, 32 };
+		runMortonOrder = true;
+		runDepthTest = true;
+		runAlphaBlending = true;
+		runLoadStoreOps = true;
+		msaaVariants = { ig::MSAA::X2, ig::MSAA::X4, ig::MSAA::X8 };
+		renderTargetFormatVariants =
+		{
+			ig::Format::FLOAT16_FLOAT16_FLOAT16_FLOAT16,
+			ig::Format::UINT10_UINT10_UINT10_UINT2,
+			ig::Format::BYTE,
+		};
+	}
+
 	void Run()
 	{
 		context = ig::IGLOContext::CreateContext(
@@ -65,10 +82,25 @@ private:
 	static constexpr uint32_t numQuads = 1'000'000;
 	static constexpr float quadSize = 2;
 	static constexpr double secondsPerBenchmark = 5;
-
+	// Extra runs. Each one reruns every benchmark, so they are off by default to keep the normal run short.
+	// Start the app with --all-runs to enable all of them.
+	bool runRasterizerDiscard = false; // Reruns all benchmarks with rasterizer discard enabled
+	std::vector<float> quadSizeVariants; // Reruns all benchmarks with each of these quad sizes
+	bool runMortonOrder = false; // Reruns all benchmarks with the quads sorted in Morton order
+	bool runDepthTest = false; // Reruns all benchmarks with a depth buffer, front-to-back and back-to-front
+	bool runAlphaBlending = false; // Reruns all benchmarks with straight and premultiplied alpha blending
+	bool runLoadStoreOps = false; // Reruns all benchmarks with render pass load/store ops instead of separate clears
+	std::vector<ig::MSAA> msaaVariants; // Capped by the device
+	std::vector<ig::Format> renderTargetFormatVariants; // Rendered offscreen, skipped if unsupported
+
+	std::vector<Quad> generatedQuads; // In the random order they were generated in
 	std::vector<Quad> quads;
 	std::vector<StructuredQuad> structuredQuads;
 	std::vector<std::unique_ptr<Benchmark>> benchmarks;
+	std::unique_ptr<ig::Texture> depthBuffer;
+	std::unique_ptr<ig::Texture> offscreenRenderTexture; // For runs with MSAA or a format other than the back buffer's
+	std::string textFontFile; // The text benchmarks are skipped if this is empty
+	bool typedBufferSupported = false; // If the device supports typed buffers with 5 elements per quad
 
 	size_t currentBenchmark = 0;
 	double appStartCooldown = 0.5;
@@ -76,6 +108,21 @@ private:
 	uint32_t numFrames = 0;
 	bool benchmarkComplete = false;
 
+	// Every benchmark is run once per run. Each run renders with different options.
+	struct BenchmarkRun
+	{
+		std::string name;
+		BenchmarkParams params;
+
+		// Render pass load and store ops. With LoadOp::Load, the attachments are cleared with separate clear calls instead.
+		ig::AttachmentOps colorOps = { .clearValue = { .color = ig::Colors::Red } };
+		ig::AttachmentOps depthOps;
+
+		std::vector<double> fps; // One per benchmark
+	};
+	std::vector<BenchmarkRun> runs;
+	size_t currentRun = 0;
+
 
 	void StartBenchmark(size_t benchmarkIndex)
 	{
@@ -88,6 +135,184 @@ private:
 		));
 	}
 
+	// Every run starts with the same quads. Only their size and order depend on the run.
+	void ResetQuads(const BenchmarkParams& params)
+	{
+		std::copy(generatedQuads.begin(), generatedQuads.end(), quads.begin());
+		for (Quad& q : quads)
+		{
+			q.width = params.quadSize;
+			q.height = params.quadSize;
+		}
+		if (params.premultipliedAlpha)
+		{
+			for (Quad& q : quads)
+			{
+				q.color.red = (uint8_t)((q.color.red * q.color.alpha) / 255);
+				q.color.green = (uint8_t)((q.color.green * q.color.alpha) / 255);
+				q.color.blue = (uint8_t)((q.color.blue * q.color.alpha) / 255);
+			}
+		}
+		if (params.mortonOrder)
+		{
+			SortQuadsMortonOrder(quads.data(), numQuads);
+		}
+
+		for (uint32_t i = 0; i < numQuads; i++)
+		{
+			const Quad& q = quads[i];
+			StructuredQuad& s = structuredQuads[i];
+			s.x = q.x;
+			s.y = q.y;
+			s.width = q.width;
+			s.height = q.height;
+			s.color = q.color;
+#ifdef IGLO_VULKAN
+			s.padding = 0;
+#endif
+		}
+	}
+
+	void StartRun(size_t runIndex)
+	{
+		currentRun = runIndex;
+		ig::Print(ig::ToString
+		(
+			"Started run ", currentRun, "/", runs.size() - 1, "  -  ", runs[currentRun].name, "\n",
+			"====================\n"
+		));
+
+		ResetQuads(runs[currentRun].params);
+
+		// The GPU is idle here, so the previous run's offscreen render texture can be replaced
+		const ig::MSAA msaa = runs[currentRun].params.renderTargetDesc.msaa;
+		const ig::Format format = runs[currentRun].params.renderTargetDesc.colorFormats.at(0);
+		offscreenRenderTexture = nullptr;
+		if (msaa != ig::MSAA::Disabled || format != context->GetBackBuffer().GetFormat())
+		{
+			offscreenRenderTexture = ig::Texture::Create(*context, context->GetWidth(), context->GetHeight(),
+				format, ig::TextureUsage::RenderTexture, msaa);
+			if (!offscreenRenderTexture) ig::Fatal("Failed to create the offscreen render texture.");
+		}
+
+		// The depth buffer must match the sample count of the run.
+		// It's used by depth tested runs and by benchmarks that require depth in every run.
+		depthBuffer = nullptr;
+		depthBuffer = ig::Texture::Create(*context, context->GetWidth(), context->GetHeight(),
+			depthBufferFormat, ig::TextureUsage::DepthBuffer, msaa);
+		if (!depthBuffer) ig::Fatal("Failed to create the depth buffer.");
+
+		// Initialize benchmarks
+		cmd->Begin();
+		{
+			const BenchmarkParams& params = runs[currentRun].params;
+
+			benchmarks.clear();
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Nothing>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_1DrawCall>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_PushConstantDrawCall>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_BatchedTriangleList>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_DynamicIndexBuffer>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_StaticIndexBuffer>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_RawVertexPulling>(*context, *cmd, params)));
+#ifdef IGLO_VULKAN
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_AddressVertexPulling>(*context, *cmd, params)));
+#endif
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_StructuredVertexPulling>(*context, *cmd, params)));
+			if (typedBufferSupported)
+			{
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_TypedVertexPulling>(*context, *cmd, params)));
+			}
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_TextureVertexPulling>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Instancing>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_ConstantBufferInstancing>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_ComputeExpansion>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_RawVertexPullingCopy>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_InstancingCopy>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_ChunkedVertexPulling>(*context, *cmd, params, 4)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_ChunkedVertexPulling>(*context, *cmd, params, 16)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_ChunkedVertexPulling>(*context, *cmd, params, 64)));
+			for (uint32_t quadsPerDraw = 1; quadsPerDraw <= numQuads; quadsPerDraw *= 10)
+			{
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_DrawGranularity>(*context, *cmd, params, quadsPerDraw)));
+			}
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUTriangles>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUIndexBuffer>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPURaw>(*context, *cmd, params)));
+			if (context->GetGraphicsSpecs().supportedShaderFeatures.waveOps)
+			{
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUWaveRaw>(*context, *cmd, params)));
+			}
+#ifdef IGLO_VULKAN
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUAddress>(*context, *cmd, params)));
+#endif
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUStructured>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPURecordLayout<PackedQuad16>>(*context, *cmd, params, false)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPURecordLayout<AlignedQuad32>>(*context, *cmd, params, false)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPURecordLayout<PackedQuad16>>(*context, *cmd, params, true)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPURecordLayout<AlignedQuad32>>(*context, *cmd, params, true)));
+			if (typedBufferSupported)
+			{
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUTyped>(*context, *cmd, params)));
+			}
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUTexture>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUInstancing>(*context, *cmd, params)));
+			if (context->GetGraphicsSpecs().supportedShaderFeatures.float16)
+			{
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPURaw>(*context, *cmd, params, true)));
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUInstancing>(*context, *cmd, params, true)));
+			}
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUConstantBuffer>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUProcedural>(*context, *cmd, params)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_TransformedQuads>(*context, *cmd, params, false)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_TransformedQuads>(*context, *cmd, params, true)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Sprites>(*context, *cmd, params, SpriteMethod::BatchedTriangleList)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Sprites>(*context, *cmd, params, SpriteMethod::RawVertexPulling)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Sprites>(*context, *cmd, params, SpriteMethod::Instancing)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Circles>(*context, *cmd, params, CircleMethod::Instancing)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Circles>(*context, *cmd, params, CircleMethod::RawVertexPulling)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Circles>(*context, *cmd, params, CircleMethod::StaticInstancing)));
+			if (!textFontFile.empty())
+			{
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_Text>(*context, *cmd, params, textFontFile, ig::FontType::Bitmap, TextStrings::Static)));
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_Text>(*context, *cmd, params, textFontFile, ig::FontType::Bitmap, TextStrings::Changing)));
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_Text>(*context, *cmd, params, textFontFile, ig::FontType::Bitmap, TextStrings::NewGlyphs)));
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_Text>(*context, *cmd, params, textFontFile, ig::FontType::SDF, TextStrings::Static)));
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_Text>(*context, *cmd, params, textFontFile, ig::FontType::SDF, TextStrings::Changing)));
+				benchmarks.push_back(std::move(std::make_unique<Benchmark_Text>(*context, *cmd, params, textFontFile, ig::FontType::SDF, TextStrings::NewGlyphs)));
+			}
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Billboards>(*context, *cmd, params, BillboardCulling::None)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Billboards>(*context, *cmd, params, BillboardCulling::CPU)));
+			benchmarks.push_back(std::move(std::make_unique<Benchmark_Billboards>(*context, *cmd, params, BillboardCulling::GPU)));
+		}
+		cmd->End();
+		context->WaitForCompletion(context->Submit(*cmd));
+
+		StartBenchmark(0);
+	}
+
+	void PrintSummary()
+	{
+		std::string summary = "Summary (FPS)\n";
+		for (size_t i = 0; i < benchmarks.size(); i++)
+		{
+			summary += ig::ToString(benchmarks[i]->GetName(), "\n");
+			const double firstRunMs = 1000.0 / runs[0].fps.at(i);
+			for (size_t r = 0; r < runs.size(); r++)
+			{
+				const double fps = runs[r].fps.at(i);
+				const double ms = 1000.0 / fps;
+				summary += ig::ToString("    ", runs[r].name, ": ", fps, " FPS (", ms, " ms");
+
+				// Show how each run changes the frame time compared to the first run
+				if (r > 0) summary += ig::ToString(", ", (ms >= firstRunMs) ? "+" : "", ms - firstRunMs, " ms");
+				summary += ")\n";
+			}
+		}
+		summary += "--------------------\n";
+		ig::Print(summary);
+	}
+
 	void Start()
 	{
 		ig::Print(ig::ToString
@@ -95,6 +320,27 @@ private:
 			"iglo v" IGLO_VERSION_STRING " " IGLO_GRAPHICS_API_STRING "\n",
 			context->GetGraphicsSpecs().rendererName, " (", context->GetGraphicsSpecs().vendorName, ")\n\n"
 		));
+		if (!context->GetGraphicsSpecs().supportedShaderFeatures.float16)
+		{
+			ig::Print("16-bit float shaders are not supported on this device. The fp16 benchmarks will be skipped.\n\n");
+		}
+		if (!context->GetGraphicsSpecs().supportedShaderFeatures.waveOps)
+		{
+			ig::Print("Wave intrinsics are not supported on this device. The wave shared load benchmark will be skipped.\n\n");
+		}
+
+		typedBufferSupported = ((uint64_t)numQuads * 5 <= context->GetGraphicsSpecs().maxTypedBufferElements);
+		if (!typedBufferSupported)
+		{
+			ig::Print(ig::ToString("Typed buffers are limited to ", context->GetGraphicsSpecs().maxTypedBufferElements,
+				" elements on this device. The typed vertex pulling benchmarks will be skipped.\n\n"));
+		}
+
+		textFontFile = FindTextFontFile();
+		if (textFontFile.empty())
+		{
+			ig::Print("No TrueType font file was found. The text benchmarks will be skipped.\n\n");
+		}
 
 		cmd = ig::CommandList::Create(*context, ig::CommandListType::Graphics);
 
@@ -104,62 +350,130 @@ private:
 			ig::Random::SetSeed(1);
 			const float max_X = (float)context->GetWidth() - quadSize;
 			const float max_Y = (float)context->GetHeight() - quadSize;
+			generatedQuads = std::vector<Quad>(numQuads);
 			quads = std::vector<Quad>(numQuads);
 			structuredQuads = std::vector<StructuredQuad>(numQuads);
 			for (uint32_t i = 0; i < numQuads; i++)
 			{
-				Quad& q = quads[i];
+				Quad& q = generatedQuads[i];
 				q.x = ig::Random::NextFloat(0, max_X);
 				q.y = ig::Random::NextFloat(0, max_Y);
 				q.width = quadSize;
 				q.height = quadSize;
 				q.color = ig::Random::NextUInt32();
-
-				StructuredQuad& s = structuredQuads[i];
-				s.x = q.x;
-				s.y = q.y;
-				s.width = q.width;
-				s.height = q.height;
-				s.color = q.color;
-#ifdef IGLO_VULKAN
-				s.padding = 0;
-#endif
 			}
 			ig::Print(" Done.\n\n");
 		}
 
-		// Initialize benchmarks
+		// Set up runs
 		{
-			cmd->Begin();
+			BenchmarkParams params =
 			{
-				BenchmarkParams params =
+				.quads = quads.data(),
+				.structuredQuads = structuredQuads.data(),
+				.numQuads = numQuads,
+				.quadSize = quadSize,
+				.viewExtent = context->GetBackBufferExtent(),
+				.renderTargetDesc = context->GetBackBufferRenderTargetDesc(),
+			};
+
+			runs.clear();
+			runs.push_back({ .name = ig::ToString("Normal (", quadSize, "px quads)"), .params = params });
+			if (runRasterizerDiscard)
+			{
+				BenchmarkParams discardParams = params;
+				discardParams.rasterizerState.enableRasterizerDiscard = true;
+				runs.push_back({ .name = "Rasterizer discard (vertex work only)", .params = discardParams });
+			}
+			for (float size : quadSizeVariants)
+			{
+				BenchmarkParams sizeParams = params;
+				sizeParams.quadSize = size;
+				std::string name = (size == 0)
+					? "Zero-area quads (no pixels)"
+					: ig::ToString(size, "px quads");
+				runs.push_back({ .name = name, .params = sizeParams });
+			}
+			if (runMortonOrder)
+			{
+				BenchmarkParams mortonParams = params;
+				mortonParams.mortonOrder = true;
+				runs.push_back({ .name = ig::ToString("Morton order (", quadSize, "px quads)"), .params = mortonParams });
+			}
+			if (runDepthTest)
+			{
+				// With Less, only the first quad drawn at each pixel passes, so the quads are drawn front-to-back.
+				BenchmarkParams frontToBackParams = params;
+				frontToBackParams.renderTargetDesc.depthFormat = depthBufferFormat;
+				frontToBackParams.depthState = ig::DepthDesc::DepthEnabled;
+				frontToBackParams.depthState.depthFunc = ig::ComparisonFunc::Less;
+				runs.push_back({ .name = "Depth tested, front-to-back (hidden quads rejected by early-Z)", .params = frontToBackParams });
+
+				// With LessOrEqual, every quad passes and the last one drawn is visible, so they are drawn back-to-front.
+				BenchmarkParams backToFrontParams = frontToBackParams;
+				backToFrontParams.depthState.depthFunc = ig::ComparisonFunc::LessOrEqual;
+				runs.push_back({ .name = "Depth tested, back-to-front (no quads rejected)", .params = backToFrontParams });
+			}
+			if (runAlphaBlending)
+			{
+				BenchmarkParams straightParams = params;
+				straightParams.blendState = ig::BlendDesc::StraightAlpha;
+				runs.push_back({ .name = "Straight alpha blending", .params = straightParams });
+
+				BenchmarkParams premultipliedParams = params;
+				premultipliedParams.blendState = ig::BlendDesc::PremultipliedAlpha;
+				premultipliedParams.premultipliedAlpha = true;
+				runs.push_back({ .name = "Premultiplied alpha blending", .params = premultipliedParams });
+			}
+			if (runLoadStoreOps)
+			{
+				const ig::AttachmentOps clearOps = { .load = ig::LoadOp::Clear, .clearValue = { .color = ig::Colors::Red } };
+				runs.push_back({ .name = "Clear load op (no separate clear)", .params = params, .colorOps = clearOps });
+				runs.push_back({ .name = "Don't care load op (not cleared)", .params = params,
+					.colorOps = { .load = ig::LoadOp::DontCare } });
+
+				// The depth buffer is never read after the render pass, so it doesn't need to be stored
+				if (runDepthTest)
 				{
-					.quads = quads.data(),
-					.structuredQuads = structuredQuads.data(),
-					.numQuads = numQuads,
-					.viewExtent = context->GetBackBufferExtent(),
-				};
-
-				benchmarks.clear();
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_Nothing>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_1DrawCall>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_BatchedTriangleList>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_DynamicIndexBuffer>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_StaticIndexBuffer>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_RawVertexPulling>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_StructuredVertexPulling>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_Instancing>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUTriangles>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUIndexBuffer>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPURaw>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUStructured>(*context, *cmd, params)));
-				benchmarks.push_back(std::move(std::make_unique<Benchmark_GPUInstancing>(*context, *cmd, params)));
+					BenchmarkParams depthParams = params;
+					depthParams.renderTargetDesc.depthFormat = depthBufferFormat;
+					depthParams.depthState = ig::DepthDesc::DepthEnabled;
+					depthParams.depthState.depthFunc = ig::ComparisonFunc::Less;
+					runs.push_back({ .name = "Depth tested, clear load ops and don't care depth store op", .params = depthParams,
+						.colorOps = clearOps, .depthOps = { .load = ig::LoadOp::Clear, .store = ig::StoreOp::DontCare } });
+				}
+			}
+			{
+				const ig::MSAA maxMSAA = context->GetMaxMultiSampleCount(params.renderTargetDesc.colorFormats.at(0));
+				ig::MSAA previous = ig::MSAA::Disabled;
+				for (ig::MSAA msaa : msaaVariants)
+				{
+					// Skip sample counts that are capped to one that already has a run
+					const ig::MSAA capped = (ig::MSAA)std::min((uint32_t)msaa, (uint32_t)maxMSAA);
+					if (capped == previous) continue;
+					previous = capped;
+
+					BenchmarkParams msaaParams = params;
+					msaaParams.renderTargetDesc.msaa = capped;
+					runs.push_back({ .name = ig::ToString((uint32_t)capped, "x MSAA"), .params = msaaParams });
+				}
+			}
+			for (ig::Format format : renderTargetFormatVariants)
+			{
+				// Test that a render texture of this format can be created before adding a run for it
+				if (!ig::Texture::Create(*context, context->GetWidth(), context->GetHeight(), format, ig::TextureUsage::RenderTexture))
+				{
+					ig::Print(ig::ToString("Render target format ", ig::GetFormatName(format), " is not supported. Its run will be skipped.\n\n"));
+					continue;
+				}
+
+				BenchmarkParams formatParams = params;
+				formatParams.renderTargetDesc.colorFormats = { format };
+				runs.push_back({ .name = ig::ToString("Offscreen ", ig::GetFormatName(format), " render target"), .params = formatParams });
 			}
-			cmd->End();
-			context->WaitForCompletion(context->Submit(*cmd));
 		}
 
-		StartBenchmark(0);
+		StartRun(0);
 	}
 
 	void OnLoopExited()
@@ -190,15 +504,28 @@ private:
 		{
 			context->WaitForIdleDevice();
 
+			const double fps = (double)numFrames / secondsPerBenchmark;
+			runs[currentRun].fps.push_back(fps);
+
 			ig::Print(ig::ToString
 			(
-				"FPS: ", (double)numFrames / secondsPerBenchmark, "\n",
+				"FPS: ", fps, "\n",
+				benchmarks[currentBenchmark]->GetResults(fps),
 				"--------------------\n"
 			));
 
 			size_t next = currentBenchmark + 1;
-			if (next >= benchmarks.size())
+			if (next < benchmarks.size())
+			{
+				StartBenchmark(next);
+			}
+			else if (currentRun + 1 < runs.size())
 			{
+				StartRun(currentRun + 1);
+			}
+			else
+			{
+				PrintSummary();
 				ig::Print
 				(
 					"Benchmark complete!\n"
@@ -207,10 +534,6 @@ private:
 				benchmarkComplete = true;
 				mainloop.EnableIdleMode(true);
 			}
-			else
-			{
-				StartBenchmark(next);
-			}
 		}
 	}
 
@@ -239,24 +562,62 @@ private:
 	{
 		if (benchmarkComplete) return;
 
+		if (currentBenchmark >= benchmarks.size()) ig::Fatal("currentBenchmark out of bounds");
+
+		const BenchmarkRun& run = runs[currentRun];
+		const bool useDepth = (run.params.renderTargetDesc.depthFormat != ig::Format::None) ||
+			benchmarks[currentBenchmark]->RequiresDepthBuffer();
+
+		// A paused render pass must keep its contents to be resumed, so benchmarks that pause always store them
+		ig::AttachmentOps colorOps = run.colorOps;
+		ig::AttachmentOps depthOps = run.depthOps;
+		if (benchmarks[currentBenchmark]->PausesRenderPass())
+		{
+			colorOps.store = ig::StoreOp::Store;
+			depthOps.store = ig::StoreOp::Store;
+		}
+
+		// MSAA runs and runs with other render target formats render into an offscreen render texture
+		const ig::Texture& renderTarget = offscreenRenderTexture ? *offscreenRenderTexture : context->GetBackBuffer();
+		const bool resolveToBackBuffer = offscreenRenderTexture && (offscreenRenderTexture->GetMSAA() != ig::MSAA::Disabled);
+
 		cmd->Begin();
 		{
-			cmd->AddTextureBarrier(context->GetBackBuffer(), ig::SimpleBarrier::Discard, ig::SimpleBarrier::RenderTarget);
+			cmd->AddTextureBarrier(renderTarget, ig::SimpleBarrier::Discard, ig::SimpleBarrier::RenderTarget);
+			if (useDepth) cmd->AddTextureBarrier(*depthBuffer, ig::SimpleBarrier::Discard, ig::SimpleBarrier::DepthWrite);
 			cmd->FlushBarriers();
 
-			cmd->BeginRenderPass(&context->GetBackBuffer());
+			cmd->BeginRenderPass(&renderTarget, colorOps, useDepth ? depthBuffer.get() : nullptr, depthOps);
 			{
 				cmd->SetViewport((float)context->GetWidth(), (float)context->GetHeight());
 				cmd->SetScissorRectangle(context->GetWidth(), context->GetHeight());
-				cmd->ClearColor(context->GetBackBuffer(), ig::Colors::Red);
+				if (colorOps.load == ig::LoadOp::Load) cmd->ClearColor(renderTarget, colorOps.clearValue.color);
+				if (useDepth && depthOps.load == ig::LoadOp::Load) cmd->ClearDepth(*depthBuffer, depthOps.clearValue.depth);
 
-				if (currentBenchmark >= benchmarks.size()) ig::Fatal("currentBenchmark out of bounds");
 				benchmarks[currentBenchmark]->OnUpdate();
 				benchmarks[currentBenchmark]->OnRender(*cmd);
 			}
 			cmd->EndRenderPass();
 
-			cmd->AddTextureBarrier(context->GetBackBuffer(), ig::SimpleBarrier::RenderTarget, ig::SimpleBarrier::Present);
+			if (resolveToBackBuffer)
+			{
+				cmd->AddTextureBarrier(*offscreenRenderTexture, ig::SimpleBarrier::RenderTarget, ig::SimpleBarrier::ResolveSource);
+				cmd->AddTextureBarrier(context->GetBackBuffer(), ig::SimpleBarrier::Discard, ig::SimpleBarrier::ResolveDest);
+				cmd->FlushBarriers();
+
+				cmd->ResolveTexture(*offscreenRenderTexture, context->GetBackBuffer());
+
+				cmd->AddTextureBarrier(context->GetBackBuffer(), ig::SimpleBarrier::ResolveDest, ig::SimpleBarrier::Present);
+			}
+			else if (offscreenRenderTexture)
+			{
+				// The offscreen result is not copied to the back buffer, so only the cost of rendering into it is measured
+				cmd->AddTextureBarrier(context->GetBackBuffer(), ig::SimpleBarrier::Discard, ig::SimpleBarrier::Present);
+			}
+			else
+			{
+				cmd->AddTextureBarrier(context->GetBackBuffer(), ig::SimpleBarrier::RenderTarget, ig::SimpleBarrier::Present);
+			}
 			cmd->FlushBarriers();
 		}
 		cmd->End();
@@ -272,11 +633,15 @@ private:
 	}
 };
 
-int main()
+int main(int argc, char* argv[])
 {
 	SetConsoleCtrlHandler(ConsoleCtrlHandler, TRUE);
 
 	std::unique_ptr<App> app = std::make_unique<App>();
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::string(argv[i]) == "--all-runs") app->EnableAllRuns();
+	}
 	app->Run();
 	app = nullptr;
 	return 0;